@@ -0,0 +1,89 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "AliasSampler.h"
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+AliasSampler::AliasSampler(const std::vector<uint32_t>& weights): weights(weights) {
+    if (weights.empty()) {
+        throw std::invalid_argument("AliasSampler: weights cannot be empty");
+    }
+
+    uint64_t total = 0;
+    for (uint32_t weight : weights) total += weight;
+
+    if (total == 0) {
+        throw std::invalid_argument("AliasSampler: at least one weight must be positive");
+    }
+
+    if (total > std::numeric_limits<uint32_t>::max() || weights.size() > std::numeric_limits<uint32_t>::max()) {
+        throw std::invalid_argument(
+            "AliasSampler: sum of weights (" + std::to_string(total) + ") is too large"
+        );
+    }
+
+    const size_t n = weights.size();
+    totalWeight = static_cast<uint32_t>(total);
+    columnReject = (0u - static_cast<uint32_t>(n)) % static_cast<uint32_t>(n);
+    coinReject = (0u - totalWeight) % totalWeight;
+
+    // Scale every weight by n, so a column "holds" exactly totalWeight.
+    std::vector<uint64_t> scaled(n);
+    std::vector<uint32_t> small;
+    std::vector<uint32_t> large;
+    small.reserve(n);
+    large.reserve(n);
+
+    for (size_t i = 0; i < n; ++i) {
+        scaled[i] = static_cast<uint64_t>(weights[i]) * n;
+        (scaled[i] < total ? small : large).push_back(static_cast<uint32_t>(i));
+    }
+
+    table.assign(n, Column{totalWeight, 0});
+
+    while (!small.empty() && !large.empty()) {
+        const uint32_t s = small.back();
+        small.pop_back();
+        const uint32_t l = large.back();
+        large.pop_back();
+
+        table[s] = Column{static_cast<uint32_t>(scaled[s]), l};
+
+        scaled[l] -= total - scaled[s];
+        (scaled[l] < total ? small : large).push_back(l);
+    }
+
+    // Leftovers are full columns (only possible by integer exactness, no rounding).
+    for (uint32_t i : small) table[i] = Column{totalWeight, i};
+    for (uint32_t i : large) table[i] = Column{totalWeight, i};
+}
+
+int AliasSampler::sampleSlow(Rng& rng) const {
+    const uint32_t column = rng.randBelow(static_cast<uint32_t>(table.size()));
+    const uint32_t coin = rng.randBelow(totalWeight);
+    const Column& entry = table[column];
+    return coin < entry.threshold ? static_cast<int>(column) : static_cast<int>(entry.alias);
+}
+
+void AliasSampler::sample(Rng& rng, std::span<int> out) const {
+    for (int& value : out) {
+        value = sample(rng);
+    }
+}
+
+std::vector<int> AliasSampler::sample(Rng& rng, size_t count) const {
+    std::vector<int> out(count);
+    sample(rng, out);
+    return out;
+}
+
+double AliasSampler::probability(size_t index) const {
+    if (index >= weights.size()) {
+        throw std::out_of_range("AliasSampler::probability: index out of range");
+    }
+    return static_cast<double>(weights[index]) / static_cast<double>(totalWeight);
+}
@@ -0,0 +1,110 @@
+/**
+ * @file AliasSampler.h
+ * @brief Walker/Vose alias table for O(1) weighted discrete draws
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_ALIASSAMPLER_H
+#define KASYNO_ALIASSAMPLER_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Rng.h"
+
+/**
+ * @class AliasSampler
+ * @brief Samples index i with probability weights[i] / sum(weights)
+ *
+ * The table is built once with Vose's method using integer arithmetic,
+ * so the sampled distribution matches the weights exactly. A draw takes
+ * one raw 64-bit value (column from the high half, coin from the low half)
+ * and one table lookup, independent of the number of outcomes.
+ */
+class AliasSampler {
+    /**
+     * @struct Column
+     * @brief One column of the alias table
+     */
+    struct Column {
+        uint32_t threshold;  ///< Coin values below this keep the column, others take the alias
+        uint32_t alias;      ///< Outcome used when the coin is above threshold
+    };
+
+    std::vector<Column> table;         ///< Alias table, one column per outcome
+    std::vector<uint32_t> weights;     ///< Original weights
+    uint32_t totalWeight = 0;          ///< Sum of weights (coin range)
+    uint32_t columnReject = 0;         ///< Lemire rejection threshold for the column draw
+    uint32_t coinReject = 0;           ///< Lemire rejection threshold for the coin draw
+
+    /**
+     * @brief Slow path used when one of the halves of a raw draw is rejected
+     * @param rng Random number generator
+     * @return int Sampled outcome
+     */
+    int sampleSlow(Rng& rng) const;
+public:
+    /**
+     * @brief Builds the alias table
+     * @param weights Non-negative integer weights, at least one positive
+     * @throws std::invalid_argument if weights are empty, all zero or sum to 2^32 or more
+     */
+    explicit AliasSampler(const std::vector<uint32_t>& weights);
+
+    /**
+     * @brief Draws one outcome
+     * @param rng Random number generator
+     * @return int Outcome index
+     */
+    int sample(Rng& rng) const {
+        const uint64_t raw = rng();
+        const uint64_t column = (raw >> 32) * table.size();
+        const uint64_t coin = (raw & 0xFFFFFFFFULL) * totalWeight;
+
+        if (static_cast<uint32_t>(column) < columnReject || static_cast<uint32_t>(coin) < coinReject) {
+            return sampleSlow(rng);
+        }
+
+        // Branch-free select: the coin is unpredictable by design.
+        const uint32_t index = static_cast<uint32_t>(column >> 32);
+        const Column& entry = table[index];
+        const uint32_t keep = 0u - static_cast<uint32_t>(static_cast<uint32_t>(coin >> 32) < entry.threshold);
+        return static_cast<int>((index & keep) | (entry.alias & ~keep));
+    }
+
+    /**
+     * @brief Fills a buffer with outcomes
+     * @param rng Random number generator
+     * @param out Output buffer
+     */
+    void sample(Rng& rng, std::span<int> out) const;
+
+    /**
+     * @brief Draws a number of outcomes
+     * @param rng Random number generator
+     * @param count Number of outcomes
+     * @return std::vector<int> Drawn outcomes
+     */
+    std::vector<int> sample(Rng& rng, size_t count) const;
+
+    /**
+     * @brief Gets the number of outcomes
+     * @return size_t Outcome count
+     */
+    size_t size() const { return table.size(); }
+
+    /**
+     * @brief Gets the exact probability of an outcome
+     * @param index Outcome index
+     * @return double Probability
+     */
+    double probability(size_t index) const;
+};
+
+#endif //KASYNO_ALIASSAMPLER_H
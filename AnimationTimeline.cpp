@@ -0,0 +1,38 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "AnimationTimeline.h"
+
+#include <thread>
+
+AnimationTimeline::AnimationTimeline(Speed speed): speed(speed), deadline(Clock::now()) {}
+
+bool AnimationTimeline::nextFrame(std::chrono::milliseconds duration, bool last) {
+    if (speed == Speed::INSTANT) {
+        if (!last) {
+            ++framesSkipped;
+            return false;
+        }
+        ++framesDrawn;
+        return true;
+    }
+
+    std::this_thread::sleep_until(deadline);
+
+    deadline += duration;
+
+    // The whole time of this frame is already gone - drop it
+    if (!last && Clock::now() >= deadline) {
+        ++framesSkipped;
+        return false;
+    }
+
+    ++framesDrawn;
+    return true;
+}
+
+void AnimationTimeline::finish() {
+    if (speed == Speed::INSTANT) return;
+    std::this_thread::sleep_until(deadline);
+}
@@ -0,0 +1,104 @@
+/**
+ * @file AnimationTimeline.h
+ * @brief Deadline-based pacing of animation frames
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_ANIMATIONTIMELINE_H
+#define KASYNO_ANIMATIONTIMELINE_H
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @class AnimationTimeline
+ * @brief Paces an animation against a monotonic clock
+ *
+ * Every frame has a duration and the frames are laid out back to back from
+ * the moment the timeline starts. nextFrame() waits for the end of the
+ * previous frame instead of sleeping a fixed time, so drawing time does not
+ * add up. When drawing falls behind, frames whose time has already passed
+ * are skipped. At INSTANT speed nothing waits and only the last frame is
+ * drawn.
+ *
+ * Typical use:
+ * @code
+ * AnimationTimeline timeline;
+ * for (int step = 0; step <= lastStep; ++step) {
+ *     if (timeline.nextFrame(durationOf(step), step == lastStep)) draw(step);
+ * }
+ * timeline.finish();
+ * @endcode
+ */
+class AnimationTimeline {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @enum Speed
+     * @brief How animations are played
+     */
+    enum class Speed {
+        NORMAL,   ///< Real time
+        INSTANT   ///< No waiting, only the final frame is drawn (headless, tests)
+    };
+
+private:
+    static inline Speed defaultSpeed = Speed::NORMAL;  ///< Speed of new timelines
+
+    Speed speed;                   ///< Playback speed
+    Clock::time_point deadline;    ///< End of the last scheduled frame
+    uint64_t framesDrawn = 0;      ///< Frames the caller was told to draw
+    uint64_t framesSkipped = 0;    ///< Frames dropped to catch up
+
+public:
+    /**
+     * @brief Constructor - starts the timeline now
+     * @param speed Playback speed
+     */
+    explicit AnimationTimeline(Speed speed = defaultSpeed);
+
+    /**
+     * @brief Schedules the next frame, waiting for the previous one to end
+     * @param duration How long the frame stays on the screen
+     * @param last Whether this is the final frame (always drawn)
+     * @return bool True if the frame should be drawn, false if it is skipped
+     */
+    bool nextFrame(std::chrono::milliseconds duration, bool last = false);
+
+    /**
+     * @brief Waits until the last scheduled frame has been shown for its duration
+     */
+    void finish();
+
+    /**
+     * @brief Gets the number of frames drawn
+     * @return uint64_t Drawn frames
+     */
+    uint64_t getFramesDrawn() const { return framesDrawn; }
+
+    /**
+     * @brief Gets the number of frames skipped
+     * @return uint64_t Skipped frames
+     */
+    uint64_t getFramesSkipped() const { return framesSkipped; }
+
+    /**
+     * @brief Sets the speed of timelines created from now on
+     * @param speed Playback speed
+     */
+    static void setDefaultSpeed(Speed speed) { defaultSpeed = speed; }
+
+    /**
+     * @brief Gets the speed of new timelines
+     * @return Speed Playback speed
+     */
+    static Speed getDefaultSpeed() { return defaultSpeed; }
+};
+
+#endif //KASYNO_ANIMATIONTIMELINE_H
@@ -0,0 +1,57 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "Bench.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+static std::atomic<uint64_t> allocationCount{0};  ///< operator new calls in the process
+
+// Counting replacements of the global allocation functions (kasyno_bench only)
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1)) return memory;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+uint64_t benchAllocationCount() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+BenchState::BenchState(uint64_t iterations, int64_t argument)
+    : iterations(iterations),
+      remaining(iterations),
+      argument(argument) {}
+
+double BenchState::elapsedSeconds() const {
+    if (!started) return 0.0;
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+double BenchState::cpuSeconds() const {
+    if (!started) return 0.0;
+    return static_cast<double>(cpuStop - cpuStart) / CLOCKS_PER_SEC;
+}
+
+std::vector<BenchRegistration>& benchRegistry() {
+    static std::vector<BenchRegistration> registry;
+    return registry;
+}
+
+bool registerBench(const std::string& name, BenchFunction function, std::vector<int64_t> args) {
+    if (args.empty()) args.push_back(0);
+    benchRegistry().push_back(BenchRegistration{name, function, std::move(args)});
+    return true;
+}
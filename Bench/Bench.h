@@ -0,0 +1,170 @@
+/**
+ * @file Bench.h
+ * @brief Minimal microbenchmark harness used by kasyno_bench
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_BENCH_H
+#define KASYNO_BENCH_H
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @class BenchState
+ * @brief Controls the timed loop of a single benchmark run
+ *
+ * A benchmark does its setup, then loops with
+ * `while (state.keepRunning()) { ... }`. Only the loop is timed.
+ */
+class BenchState {
+    using Clock = std::chrono::steady_clock;
+
+    uint64_t iterations;        ///< Iterations requested by the runner
+    uint64_t remaining;         ///< Iterations left in the loop
+    int64_t argument;           ///< Benchmark argument (size, count...)
+    uint64_t itemsProcessed = 0;///< Items processed in the whole loop (0 = iterations)
+    std::vector<std::pair<std::string, double>> counters;  ///< Extra per-run results (bytes/frame...)
+    bool started = false;       ///< Whether the timer is running
+    Clock::time_point start;    ///< Loop start time
+    Clock::time_point stop;     ///< Loop end time
+    std::clock_t cpuStart = 0;  ///< Process CPU time at the loop start
+    std::clock_t cpuStop = 0;   ///< Process CPU time at the loop end
+public:
+    /**
+     * @brief Constructor
+     * @param iterations Number of loop iterations
+     * @param argument Benchmark argument
+     */
+    BenchState(uint64_t iterations, int64_t argument);
+
+    /**
+     * @brief Advances the timed loop
+     * @return bool True while iterations remain
+     */
+    bool keepRunning() {
+        if (!started) {
+            started = true;
+            cpuStart = std::clock();
+            start = Clock::now();
+        }
+        if (remaining == 0) {
+            stop = Clock::now();
+            cpuStop = std::clock();
+            return false;
+        }
+        --remaining;
+        return true;
+    }
+
+    /**
+     * @brief Gets the benchmark argument
+     * @return int64_t Argument value
+     */
+    int64_t arg() const { return argument; }
+
+    /**
+     * @brief Gets the number of iterations of this run
+     * @return uint64_t Iteration count
+     */
+    uint64_t getIterations() const { return iterations; }
+
+    /**
+     * @brief Sets how many items the whole loop processed (for per-item cost)
+     * @param items Item count
+     */
+    void setItemsProcessed(uint64_t items) { itemsProcessed = items; }
+
+    /**
+     * @brief Gets the number of processed items
+     * @return uint64_t Item count (iterations if not set)
+     */
+    uint64_t getItemsProcessed() const { return itemsProcessed ? itemsProcessed : iterations; }
+
+    /**
+     * @brief Reports an extra result printed next to the timings
+     * @param name Counter name (e.g. "bytes/frame")
+     * @param value Counter value
+     */
+    void setCounter(const std::string& name, double value) { counters.emplace_back(name, value); }
+
+    /**
+     * @brief Gets the extra results
+     * @return const std::vector<std::pair<std::string, double>>& Counter names and values
+     */
+    const std::vector<std::pair<std::string, double>>& getCounters() const { return counters; }
+
+    /**
+     * @brief Gets the duration of the timed loop
+     * @return double Elapsed seconds
+     */
+    double elapsedSeconds() const;
+
+    /**
+     * @brief Gets the CPU time the process used during the timed loop
+     * @return double CPU seconds (all threads of the process)
+     */
+    double cpuSeconds() const;
+};
+
+using BenchFunction = void (*)(BenchState&);  ///< Benchmark body
+
+/**
+ * @struct BenchRegistration
+ * @brief A registered benchmark with the arguments it runs with
+ */
+struct BenchRegistration {
+    std::string name;              ///< Benchmark name
+    BenchFunction function;        ///< Benchmark body
+    std::vector<int64_t> args;     ///< Arguments (one run per argument)
+};
+
+/**
+ * @brief Gets the global benchmark registry
+ * @return std::vector<BenchRegistration>& Registered benchmarks
+ */
+std::vector<BenchRegistration>& benchRegistry();
+
+/**
+ * @brief Registers a benchmark
+ * @param name Benchmark name
+ * @param function Benchmark body
+ * @param args Arguments (empty = single run with argument 0)
+ * @return bool Always true (used for static registration)
+ */
+bool registerBench(const std::string& name, BenchFunction function, std::vector<int64_t> args = {});
+
+/**
+ * @brief Gets the number of heap allocations (operator new) made so far
+ * @return uint64_t Allocation count
+ */
+uint64_t benchAllocationCount();
+
+/**
+ * @brief Prevents the compiler from optimizing away a computed value
+ * @param value Value to keep
+ */
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/// @brief Registers a benchmark function, optionally with a list of arguments
+#define KASYNO_BENCH(function, ...) \
+    static const bool function##Registered = registerBench(#function, function, {__VA_ARGS__})
+
+#endif //KASYNO_BENCH_H
@@ -0,0 +1,310 @@
+/**
+ * @file BenchMain.cpp
+ * @brief Entry point of the kasyno_bench microbenchmark runner
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Bench.h"
+#include "../CommandLine.h"
+
+static constexpr double MAX_MIN_TIME = 3600.0;  ///< Longest accepted --min-time (seconds)
+
+/**
+ * @struct BenchConfig
+ * @brief Runner options
+ */
+struct BenchConfig {
+    std::string filter;     ///< Only run benchmarks whose name contains this text
+    double minTime = 0.2;   ///< Minimum measured time per benchmark (seconds)
+    int repetitions = 1;    ///< Measured runs per benchmark argument
+    std::string jsonPath;   ///< Where to write the JSON report ("" = none)
+};
+
+/**
+ * @struct BenchResult
+ * @brief One measured run (or the median of several)
+ */
+struct BenchResult {
+    std::string name;                                     ///< Benchmark name with argument
+    bool aggregate = false;                               ///< Median of the repetitions
+    int repetitions = 1;                                  ///< Repetitions of the benchmark
+    int repetitionIndex = 0;                              ///< Index of this run
+    uint64_t iterations = 0;                              ///< Loop iterations
+    double realNs = 0.0;                                  ///< Wall time per iteration (ns)
+    double cpuNs = 0.0;                                   ///< CPU time per iteration (ns)
+    double itemsPerSecond = 0.0;                          ///< Processed items per second
+    std::vector<std::pair<std::string, double>> counters; ///< Extra results
+};
+
+/**
+ * @brief Runs one benchmark argument until it takes at least minTime
+ * @param registration Benchmark to run
+ * @param arg Argument to pass
+ * @param minTime Minimum measured time (seconds)
+ * @return BenchResult Measured run
+ */
+static BenchResult runOne(const BenchRegistration& registration, int64_t arg, double minTime) {
+    uint64_t iterations = 1;
+
+    while (true) {
+        BenchState state(iterations, arg);
+        registration.function(state);
+
+        const double elapsed = state.elapsedSeconds();
+        if (elapsed >= minTime || iterations >= (1ULL << 40)) {
+            BenchResult result;
+            result.name = registration.name;
+            if (registration.args.size() > 1 || arg != 0) {
+                result.name += "/" + std::to_string(arg);
+            }
+
+            result.iterations = iterations;
+            result.realNs = elapsed * 1e9 / static_cast<double>(iterations);
+            result.cpuNs = state.cpuSeconds() * 1e9 / static_cast<double>(iterations);
+            result.itemsPerSecond = elapsed > 0.0 ? state.getItemsProcessed() / elapsed : 0.0;
+            result.counters = state.getCounters();
+            return result;
+        }
+
+        double factor = elapsed > 0.0 ? minTime / elapsed * 1.4 : 100.0;
+        factor = std::clamp(factor, 2.0, 100.0);
+        iterations = static_cast<uint64_t>(static_cast<double>(iterations) * factor);
+    }
+}
+
+/**
+ * @brief Gets the median of a value over several runs
+ * @param runs Runs of one benchmark argument
+ * @param value Value to take from each run
+ * @return double Median
+ */
+template <typename Value>
+static double median(const std::vector<BenchResult>& runs, Value value) {
+    std::vector<double> values;
+    for (const BenchResult& run : runs) values.push_back(value(run));
+    std::sort(values.begin(), values.end());
+
+    const size_t middle = values.size() / 2;
+    return values.size() % 2 ? values[middle] : (values[middle - 1] + values[middle]) / 2.0;
+}
+
+/**
+ * @brief Builds the median row of repeated runs
+ * @param runs Runs of one benchmark argument (at least one)
+ * @return BenchResult Median of every value
+ */
+static BenchResult medianOf(const std::vector<BenchResult>& runs) {
+    BenchResult result = runs.front();
+    result.name += "_median";
+    result.aggregate = true;
+    result.iterations = static_cast<uint64_t>(median(runs, [](const BenchResult& r) { return static_cast<double>(r.iterations); }));
+    result.realNs = median(runs, [](const BenchResult& r) { return r.realNs; });
+    result.cpuNs = median(runs, [](const BenchResult& r) { return r.cpuNs; });
+    result.itemsPerSecond = median(runs, [](const BenchResult& r) { return r.itemsPerSecond; });
+
+    for (size_t i = 0; i < result.counters.size(); ++i) {
+        result.counters[i].second = median(runs, [i](const BenchResult& r) {
+            return i < r.counters.size() ? r.counters[i].second : 0.0;
+        });
+    }
+
+    return result;
+}
+
+/**
+ * @brief Prints one result row
+ * @param result Run to print
+ */
+static void printResult(const BenchResult& result) {
+    const double itemsPerIteration = result.itemsPerSecond * result.realNs / 1e9;
+    std::printf("%-40s %14llu %14.2f %12.3f %12.2f",
+                result.name.c_str(),
+                static_cast<unsigned long long>(result.iterations),
+                result.realNs,
+                itemsPerIteration > 0.0 ? result.realNs / itemsPerIteration : 0.0,
+                result.itemsPerSecond / 1e6);
+    for (const auto& [counter, value] : result.counters) {
+        std::printf("  %s=%.2f", counter.c_str(), value);
+    }
+    std::printf("\n");
+}
+
+/**
+ * @brief Quotes a string for JSON
+ * @param text Raw text
+ * @return std::string Quoted and escaped text
+ */
+static std::string jsonString(const std::string& text) {
+    std::string quoted = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            quoted += '\\';
+            quoted += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            quoted += escaped;
+        } else {
+            quoted += c;
+        }
+    }
+    return quoted + "\"";
+}
+
+/**
+ * @brief Writes the results in the Google Benchmark JSON format
+ *
+ * The layout matches `--benchmark_format=json`, so reports from two builds
+ * can be compared with Google Benchmark's tools/compare.py.
+ *
+ * @param path Output file
+ * @param executable Runner path (argv[0])
+ * @param results Runs and aggregates in report order
+ */
+static void writeJson(const std::string& path, const std::string& executable, const std::vector<BenchResult>& results) {
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) {
+        throw std::runtime_error("Cannot write " + path);
+    }
+
+    char date[32];
+    const std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+#ifdef NDEBUG
+    const char* buildType = "release";
+#else
+    const char* buildType = "debug";
+#endif
+
+    std::fprintf(file, "{\n  \"context\": {\n");
+    std::fprintf(file, "    \"date\": %s,\n", jsonString(date).c_str());
+    std::fprintf(file, "    \"executable\": %s,\n", jsonString(executable).c_str());
+    std::fprintf(file, "    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+    std::fprintf(file, "    \"library_build_type\": \"%s\"\n  },\n", buildType);
+    std::fprintf(file, "  \"benchmarks\": [");
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        const std::string runName = r.aggregate ? r.name.substr(0, r.name.size() - 7) : r.name;
+
+        std::fprintf(file, "%s\n    {\n", i ? "," : "");
+        std::fprintf(file, "      \"name\": %s,\n", jsonString(r.name).c_str());
+        std::fprintf(file, "      \"run_name\": %s,\n", jsonString(runName).c_str());
+        std::fprintf(file, "      \"run_type\": \"%s\",\n", r.aggregate ? "aggregate" : "iteration");
+        std::fprintf(file, "      \"repetitions\": %d,\n", r.repetitions);
+        if (r.aggregate) {
+            std::fprintf(file, "      \"aggregate_name\": \"median\",\n");
+        } else {
+            std::fprintf(file, "      \"repetition_index\": %d,\n", r.repetitionIndex);
+        }
+        std::fprintf(file, "      \"threads\": 1,\n");
+        std::fprintf(file, "      \"iterations\": %llu,\n", static_cast<unsigned long long>(r.iterations));
+        std::fprintf(file, "      \"real_time\": %.6g,\n", r.realNs);
+        std::fprintf(file, "      \"cpu_time\": %.6g,\n", r.cpuNs);
+        std::fprintf(file, "      \"time_unit\": \"ns\",\n");
+        for (const auto& [counter, value] : r.counters) {
+            std::fprintf(file, "      %s: %.6g,\n", jsonString(counter).c_str(), value);
+        }
+        std::fprintf(file, "      \"items_per_second\": %.6g\n    }", r.itemsPerSecond);
+    }
+
+    std::fprintf(file, "\n  ]\n}\n");
+    const bool ok = std::fclose(file) == 0;
+    if (!ok) {
+        throw std::runtime_error("Cannot write " + path);
+    }
+}
+
+/**
+ * @brief Main entry point of the benchmark runner
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return int Exit code (0 for success)
+ */
+int main(int argc, char** argv) {
+    BenchConfig config;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string option = argv[i];
+
+            if (option == "--help" || option == "-h") {
+                std::cout << "Usage: kasyno_bench [--filter TEXT] [--min-time SECONDS] [--repetitions N] [--json FILE]\n";
+                return 0;
+            }
+
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Missing value for " + option);
+            }
+
+            const std::string value = argv[++i];
+            if (option == "--filter") {
+                config.filter = value;
+            } else if (option == "--min-time") {
+                config.minTime = CommandLine::parseDecimal(option, value, 0.0, MAX_MIN_TIME);
+            } else if (option == "--repetitions") {
+                config.repetitions = CommandLine::parseNumber<int>(option, value);
+                if (config.repetitions < 1) {
+                    throw std::invalid_argument("--repetitions must be at least 1");
+                }
+            } else if (option == "--json") {
+                config.jsonPath = value;
+            } else {
+                throw std::invalid_argument("Unknown option: " + option);
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::printf("%-40s %14s %14s %12s %12s\n", "Benchmark", "Iterations", "ns/iter", "ns/item", "M items/s");
+
+    std::vector<BenchResult> results;
+    for (const auto& registration : benchRegistry()) {
+        if (!config.filter.empty() && registration.name.find(config.filter) == std::string::npos) {
+            continue;
+        }
+
+        for (int64_t arg : registration.args) {
+            std::vector<BenchResult> runs;
+            for (int repetition = 0; repetition < config.repetitions; ++repetition) {
+                BenchResult run = runOne(registration, arg, config.minTime);
+                run.repetitions = config.repetitions;
+                run.repetitionIndex = repetition;
+                printResult(run);
+                runs.push_back(std::move(run));
+            }
+
+            results.insert(results.end(), runs.begin(), runs.end());
+            if (config.repetitions > 1) {
+                results.push_back(medianOf(runs));
+                printResult(results.back());
+            }
+        }
+    }
+
+    if (!config.jsonPath.empty()) {
+        try {
+            writeJson(config.jsonPath, argv[0], results);
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "Bench.h"
+#include "../Games/Shoe.h"
+
+/**
+ * @struct LegacyCard
+ * @brief Card layout used before the one-byte encoding
+ */
+struct LegacyCard {
+    std::string rank;
+    Suit suit;
+    int value;
+};
+
+static constexpr int CARDS_PER_ROUND = 5;  ///< Typical deal: two hands and one hit
+
+static std::vector<std::vector<LegacyCard>> legacyDeck() {
+    std::vector<std::vector<LegacyCard>> deck;
+    for (int suit = 0; suit < Card::SUIT_COUNT; ++suit) {
+        std::vector<LegacyCard> suitCards;
+        for (int rank = 0; rank < Card::RANK_COUNT; ++rank) {
+            const Card card = Card::make(rank, static_cast<Suit>(suit));
+            suitCards.push_back(LegacyCard{card.rank(), card.suit(), card.value()});
+        }
+        deck.push_back(suitCards);
+    }
+    return deck;
+}
+
+/**
+ * @brief Round loop used before the shoe: flatten, shuffle and re-chunk per round, pop from the back
+ * @param state Benchmark state
+ */
+static void BlackjackDealLegacy(BenchState& state) {
+    Rng rng = Rng::forStream(42, 0);
+    std::vector<std::vector<LegacyCard>> deck = legacyDeck();
+    size_t left = Card::DECK_SIZE;
+
+    while (state.keepRunning()) {
+        if (left < CARDS_PER_ROUND) {
+            deck = legacyDeck();
+            left = Card::DECK_SIZE;
+        }
+
+        std::vector<LegacyCard> flatDeck;
+        for (const auto& suitCards : deck) {
+            flatDeck.insert(flatDeck.end(), suitCards.begin(), suitCards.end());
+        }
+        for (size_t i = flatDeck.size() - 1; i > 0; --i) {
+            size_t j = static_cast<size_t>(rng.randInt(0, static_cast<int>(i)));
+            std::swap(flatDeck[i], flatDeck[j]);
+        }
+        deck.clear();
+        for (size_t i = 0; i < flatDeck.size(); i += Card::RANK_COUNT) {
+            deck.emplace_back(flatDeck.begin() + i,
+                              flatDeck.begin() + std::min(i + Card::RANK_COUNT, flatDeck.size()));
+        }
+
+        int sum = 0;
+        for (int c = 0; c < CARDS_PER_ROUND; ++c) {
+            for (auto& suitCards : deck) {
+                if (!suitCards.empty()) {
+                    sum += suitCards.back().value;
+                    suitCards.pop_back();
+                    break;
+                }
+            }
+        }
+        left -= CARDS_PER_ROUND;
+        doNotOptimize(sum);
+    }
+
+    state.setItemsProcessed(state.getIterations() * CARDS_PER_ROUND);
+}
+
+/**
+ * @brief Round loop on the flat shoe: reshuffle at the cut card, then deal
+ * @param state Benchmark state (arg = deck count)
+ */
+static void BlackjackDealShoe(BenchState& state) {
+    Rng rng = Rng::forStream(42, 0);
+    Shoe shoe(static_cast<int>(state.arg()));
+    shoe.shuffle(rng);
+
+    while (state.keepRunning()) {
+        if (shoe.needsShuffle()) {
+            shoe.shuffle(rng);
+        }
+
+        int sum = 0;
+        for (int c = 0; c < CARDS_PER_ROUND; ++c) {
+            sum += shoe.draw().value();
+        }
+        doNotOptimize(sum);
+    }
+
+    state.setItemsProcessed(state.getIterations() * CARDS_PER_ROUND);
+}
+
+static void BlackjackShuffleShoe(BenchState& state) {
+    Rng rng = Rng::forStream(42, 0);
+    Shoe shoe(static_cast<int>(state.arg()));
+
+    while (state.keepRunning()) {
+        shoe.shuffle(rng);
+        doNotOptimize(shoe.remainingCards().data());
+    }
+
+    state.setItemsProcessed(state.getIterations() * shoe.size());
+}
+
+KASYNO_BENCH(BlackjackDealLegacy);
+KASYNO_BENCH(BlackjackDealShoe, 1, 6);
+KASYNO_BENCH(BlackjackShuffleShoe, 1, 6, 8);
@@ -0,0 +1,71 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "Bench.h"
+#include "../Games/BlackjackEngine.h"
+#include "../Games/RouletteEngine.h"
+#include "../Games/SlotsEngine.h"
+
+/**
+ * @brief Resolves rounds through the GameEngine interface and reports the return
+ * @param state Benchmark state
+ * @param engine Engine to play
+ * @param slip Bets of every round
+ * @param rng Random number generator
+ */
+static void resolveRounds(BenchState& state, GameEngine& engine, const BetSlip& slip, Rng& rng) {
+    int64_t staked = 0;
+    int64_t paid = 0;
+
+    while (state.keepRunning()) {
+        const RoundOutcome outcome = engine.resolveRound(slip, rng);
+        staked += outcome.staked;
+        paid += outcome.paid;
+    }
+
+    state.setCounter("rtp", staked ? static_cast<double>(paid) / static_cast<double>(staked) : 0.0);
+}
+
+/**
+ * @brief Slots round without UI (spin, evaluate, payout)
+ * @param state Benchmark state
+ */
+static void SlotsResolveRound(BenchState& state) {
+    Rng rng = Rng::forStream(42, 0);
+    SlotsEngine engine;
+
+    resolveRounds(state, engine, BetSlip::single(10), rng);
+}
+
+/**
+ * @brief Roulette round without UI, with a typical mix of bets
+ * @param state Benchmark state
+ */
+static void RouletteResolveRound(BenchState& state) {
+    Rng rng = Rng::forStream(42, 0);
+    RouletteEngine engine;
+
+    RouletteBetSlip slip;
+    slip.add(RouletteBetType::BET_RED, -1, 10);
+    slip.add(RouletteBetType::BET_NUMBER, 17, 5);
+    slip.add(RouletteBetType::BET_CORNER, 1, 5);
+    slip.add(RouletteBetType::BET_DOZEN, 2, 10);
+
+    resolveRounds(state, engine, BetSlip::roulette(slip), rng);
+}
+
+/**
+ * @brief Blackjack round without UI, played by basic strategy
+ * @param state Benchmark state
+ */
+static void BlackjackResolveRound(BenchState& state) {
+    Rng rng = Rng::forStream(42, 0);
+    BlackjackEngine engine(rng);
+
+    resolveRounds(state, engine, BetSlip::single(10, 1000), rng);
+}
+
+KASYNO_BENCH(SlotsResolveRound);
+KASYNO_BENCH(RouletteResolveRound);
+KASYNO_BENCH(BlackjackResolveRound);
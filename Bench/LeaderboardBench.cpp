@@ -0,0 +1,239 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Bench.h"
+#include "../FileHandler.h"
+#include "../LeaderboardBinary.h"
+#include "../LeaderboardStore.h"
+#include "../Rng.h"
+
+/**
+ * @brief Removes a leaderboard file with its journal and lock file
+ * @param path Leaderboard file path
+ */
+static void removeLeaderboardFiles(const std::string& path) {
+    std::filesystem::remove(path);
+    std::filesystem::remove(path + ".journal");
+    std::filesystem::remove(path + ".lock");
+}
+
+/**
+ * @brief Writes a leaderboard file with random balances
+ * @param count Number of players
+ * @return std::string File path
+ */
+static std::string makeLeaderboardFile(size_t count) {
+    const std::string path = (std::filesystem::temp_directory_path() / "kasyno_bench_leaderboard.txt").string();
+    Rng rng = Rng::forStream(11, 0);
+    removeLeaderboardFiles(path);
+
+    std::ofstream file(path, std::ios::trunc);
+    for (size_t i = 0; i < count; ++i) {
+        file << "player" << i << "||" << rng.randInt(0, 1000000) << "\n";
+    }
+
+    return path;
+}
+
+/**
+ * @brief Text and binary leaderboards with one million players, written once per run
+ */
+struct MillionLeaderboard {
+    static constexpr size_t PLAYERS = 1000000;  ///< Players in the files
+
+    std::string textPath;    ///< name||balance file
+    std::string binaryPath;  ///< Binary file
+
+    MillionLeaderboard() {
+        const std::string path = makeLeaderboardFile(PLAYERS);
+        textPath = path + ".1m";
+        binaryPath = path + ".bin";
+        std::filesystem::rename(path, textPath);
+        LeaderboardBinary::convertText(textPath, binaryPath);
+    }
+
+    ~MillionLeaderboard() {
+        removeLeaderboardFiles(textPath);
+        std::filesystem::remove(binaryPath);
+    }
+};
+
+/**
+ * @brief Gets the shared one-million-player files
+ * @return const MillionLeaderboard& Files
+ */
+static const MillionLeaderboard& millionLeaderboard() {
+    static const MillionLeaderboard files;
+    return files;
+}
+
+/**
+ * @brief Load used before the binary format (getline, substr, stoi, sort)
+ * @param state Benchmark state
+ */
+static void LeaderboardLoadText(BenchState& state) {
+    const MillionLeaderboard& files = millionLeaderboard();
+
+    while (state.keepRunning()) {
+        std::vector<LeaderboardEntry> entries;
+        std::ifstream file(files.textPath);
+        std::string line;
+        while (std::getline(file, line)) {
+            size_t pos = line.find("||");
+            if (pos == std::string::npos) continue;
+            LeaderboardEntry entry;
+            entry.name = line.substr(0, pos);
+            entry.balance = std::stoi(line.substr(pos + 2));
+            entries.push_back(entry);
+        }
+        std::sort(entries.begin(), entries.end(), [](const LeaderboardEntry& a, const LeaderboardEntry& b) {
+            return a.balance > b.balance;
+        });
+        doNotOptimize(entries.data());
+    }
+
+    state.setItemsProcessed(state.getIterations() * MillionLeaderboard::PLAYERS);
+}
+
+static void LeaderboardLoadStore(BenchState& state) {
+    const MillionLeaderboard& files = millionLeaderboard();
+
+    while (state.keepRunning()) {
+        LeaderboardStore store(files.textPath);
+        doNotOptimize(store.size());
+    }
+
+    state.setItemsProcessed(state.getIterations() * MillionLeaderboard::PLAYERS);
+}
+
+static void LeaderboardLoadBinary(BenchState& state) {
+    const MillionLeaderboard& files = millionLeaderboard();
+
+    while (state.keepRunning()) {
+        LeaderboardView view(files.binaryPath);
+
+        // Touch every entry so the pages are actually read
+        int64_t total = 0;
+        for (size_t i = 0; i < view.size(); ++i) {
+            total += view.balance(i) + static_cast<int64_t>(view.name(i).size());
+        }
+        doNotOptimize(total);
+    }
+
+    state.setItemsProcessed(state.getIterations() * MillionLeaderboard::PLAYERS);
+}
+
+static void LeaderboardTopK(BenchState& state) {
+    static const LeaderboardStore store(millionLeaderboard().textPath);
+    const size_t count = static_cast<size_t>(state.arg());
+    Rng rng = Rng::forStream(42, 0);
+
+    while (state.keepRunning()) {
+        // Random page, so the walk down the treap is part of the cost
+        const size_t first = rng.randBelow(static_cast<uint32_t>(store.size() - count));
+        auto entries = store.range(first, count);
+        doNotOptimize(entries.data());
+    }
+
+    state.setItemsProcessed(state.getIterations() * count);
+}
+
+/**
+ * @brief Upsert used before LeaderboardStore (load, sort, find_if, rewrite everything)
+ * @param state Benchmark state
+ */
+static void LeaderboardUpsertRewrite(BenchState& state) {
+    const size_t count = static_cast<size_t>(state.arg());
+    const std::string path = makeLeaderboardFile(count);
+    Rng rng = Rng::forStream(42, 0);
+
+    while (state.keepRunning()) {
+        std::vector<LeaderboardEntry> entries;
+        std::ifstream in(path);
+        std::string line;
+        while (std::getline(in, line)) {
+            size_t pos = line.find("||");
+            entries.push_back(LeaderboardEntry{line.substr(0, pos), std::stoi(line.substr(pos + 2))});
+        }
+        in.close();
+        std::sort(entries.begin(), entries.end(), [](const LeaderboardEntry& a, const LeaderboardEntry& b) {
+            return a.balance > b.balance;
+        });
+
+        const std::string name = "player" + std::to_string(rng.randBelow(static_cast<uint32_t>(count)));
+        auto it = std::find_if(entries.begin(), entries.end(), [&name](const LeaderboardEntry& e) {
+            return e.name == name;
+        });
+        it->balance = rng.randInt(0, 1000000);
+
+        std::ofstream out(path, std::ios::trunc);
+        for (const auto& entry : entries) {
+            out << entry.name << "||" << entry.balance << "\n";
+        }
+    }
+
+    removeLeaderboardFiles(path);
+}
+
+static void LeaderboardUpsertStore(BenchState& state) {
+    const size_t count = static_cast<size_t>(state.arg());
+    const std::string path = makeLeaderboardFile(count);
+    LeaderboardStore store(path);
+    Rng rng = Rng::forStream(42, 0);
+
+    while (state.keepRunning()) {
+        const std::string name = "player" + std::to_string(rng.randBelow(static_cast<uint32_t>(count)));
+        bool stored = store.upsert(LeaderboardEntry{name, rng.randInt(0, 1000000)});
+        doNotOptimize(stored);
+    }
+
+    removeLeaderboardFiles(path);
+}
+
+static void LeaderboardRankOf(BenchState& state) {
+    const size_t count = static_cast<size_t>(state.arg());
+    const std::string path = makeLeaderboardFile(count);
+    LeaderboardStore store(path);
+    Rng rng = Rng::forStream(42, 0);
+
+    while (state.keepRunning()) {
+        auto rank = store.rankOf("player" + std::to_string(rng.randBelow(static_cast<uint32_t>(count))));
+        doNotOptimize(rank);
+    }
+
+    removeLeaderboardFiles(path);
+}
+
+/**
+ * @brief FileHandler::loadLeaderboard as the menus call it (store already open)
+ * @param state Benchmark state
+ */
+static void FileHandlerLoadLeaderboard(BenchState& state) {
+    const size_t count = static_cast<size_t>(state.arg());
+    const std::string path = makeLeaderboardFile(count);
+    doNotOptimize(FileHandler::loadLeaderboard(path).size());
+
+    while (state.keepRunning()) {
+        auto entries = FileHandler::loadLeaderboard(path);
+        doNotOptimize(entries.data());
+    }
+
+    state.setItemsProcessed(state.getIterations() * count);
+    removeLeaderboardFiles(path);
+}
+
+KASYNO_BENCH(LeaderboardUpsertRewrite, 10000);
+KASYNO_BENCH(LeaderboardUpsertStore, 10000);
+KASYNO_BENCH(LeaderboardRankOf, 100000);
+KASYNO_BENCH(LeaderboardLoadText);
+KASYNO_BENCH(LeaderboardLoadStore);
+KASYNO_BENCH(LeaderboardLoadBinary);
+KASYNO_BENCH(LeaderboardTopK, 100);
+KASYNO_BENCH(FileHandlerLoadLeaderboard, 100, 10000, 100000);
@@ -0,0 +1,124 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "Bench.h"
+#include "../TaskPool.h"
+#include "../Games/BlackjackEngine.h"
+#include "../Games/SlotsEngine.h"
+
+static constexpr size_t TASKS_PER_BATCH = 256;   ///< Tasks per benchmark iteration
+static constexpr size_t HEAVY_TASKS = 32;        ///< Blackjack tasks, at the front as in a sorted shard list
+static constexpr int BLACKJACK_ROUNDS = 200;     ///< Rounds of a heavy task
+static constexpr int SLOTS_SPINS = 400;          ///< Spins of a light task
+
+/**
+ * @struct RoundTask
+ * @brief Generator and engines of one task, reused between iterations
+ */
+struct RoundTask {
+    Rng rng;                    ///< Private substream
+    SlotsEngine slots;          ///< Light work
+    BlackjackEngine blackjack;  ///< Heavy work
+    int64_t paid = 0;           ///< Keeps the results alive
+
+    explicit RoundTask(Rng stream): rng(std::move(stream)), blackjack(rng) {}
+};
+
+/**
+ * @brief Builds the tasks of a batch
+ * @return std::vector<std::unique_ptr<RoundTask>> One state per task
+ */
+static std::vector<std::unique_ptr<RoundTask>> makeTasks() {
+    Rng cursor = Rng::forStream(42, 0);
+    std::vector<std::unique_ptr<RoundTask>> tasks;
+    for (size_t i = 0; i < TASKS_PER_BATCH; ++i) {
+        tasks.push_back(std::make_unique<RoundTask>(cursor.split()));
+    }
+    return tasks;
+}
+
+/**
+ * @brief Plays one task: blackjack rounds for the heavy ones, slot spins for the rest
+ * @param task Task state
+ * @param index Task index
+ */
+static void playTask(RoundTask& task, size_t index) {
+    if (index < HEAVY_TASKS) {
+        for (int i = 0; i < BLACKJACK_ROUNDS; ++i) {
+            task.paid += task.blackjack.resolveRound(BetSlip::single(10, 1000), task.rng).paid;
+        }
+    } else {
+        for (int i = 0; i < SLOTS_SPINS; ++i) {
+            task.paid += task.slots.resolveRound(BetSlip::single(10), task.rng).paid;
+        }
+    }
+}
+
+/**
+ * @brief Rounds played by one batch
+ * @return uint64_t Blackjack rounds plus slot spins
+ */
+static constexpr uint64_t roundsPerBatch() {
+    return HEAVY_TASKS * BLACKJACK_ROUNDS + (TASKS_PER_BATCH - HEAVY_TASKS) * SLOTS_SPINS;
+}
+
+/**
+ * @brief Mixed batch, one pool task per round task (work stealing balances it)
+ * @param state Benchmark state (argument = threads)
+ */
+static void PoolMixedRounds(BenchState& state) {
+    auto tasks = makeTasks();
+    TaskPool pool(static_cast<unsigned>(state.arg()));
+    const uint64_t stealsBefore = pool.getSteals();
+
+    while (state.keepRunning()) {
+        pool.parallelFor(TASKS_PER_BATCH, [&tasks](size_t i) { playTask(*tasks[i], i); });
+    }
+
+    state.setItemsProcessed(state.getIterations() * roundsPerBatch());
+    state.setCounter("steals/batch", static_cast<double>(pool.getSteals() - stealsBefore) /
+                                     static_cast<double>(state.getIterations()));
+}
+
+/**
+ * @brief Same batch cut into one contiguous shard per thread, as the simulators did before
+ * @param state Benchmark state (argument = threads)
+ */
+static void StaticMixedRounds(BenchState& state) {
+    auto tasks = makeTasks();
+    const size_t threads = static_cast<size_t>(state.arg());
+    TaskPool pool(static_cast<unsigned>(threads));
+
+    while (state.keepRunning()) {
+        pool.parallelFor(threads, [&tasks, threads](size_t shard) {
+            const size_t begin = TASKS_PER_BATCH * shard / threads;
+            const size_t end = TASKS_PER_BATCH * (shard + 1) / threads;
+            for (size_t i = begin; i < end; ++i) playTask(*tasks[i], i);
+        });
+    }
+
+    state.setItemsProcessed(state.getIterations() * roundsPerBatch());
+}
+
+/**
+ * @brief Cost of scheduling empty tasks (submit, steal, wait)
+ * @param state Benchmark state (argument = threads)
+ */
+static void PoolEmptyTasks(BenchState& state) {
+    TaskPool pool(static_cast<unsigned>(state.arg()));
+
+    while (state.keepRunning()) {
+        pool.parallelFor(TASKS_PER_BATCH, [](size_t) {});
+    }
+
+    state.setItemsProcessed(state.getIterations() * TASKS_PER_BATCH);
+}
+
+KASYNO_BENCH(PoolMixedRounds, 1, 2, 4, 8, 16, 32);
+KASYNO_BENCH(StaticMixedRounds, 1, 2, 4, 8, 16, 32);
+KASYNO_BENCH(PoolEmptyTasks, 1, 4, 32);
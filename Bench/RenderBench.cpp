@@ -0,0 +1,152 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Bench.h"
+#include "../RoundUI.h"
+#include "../TerminalGeometry.h"
+#include "../TextWidth.h"
+#include "../Resources/TextRes.h"
+
+#ifdef _WIN32
+#define fileno _fileno
+static constexpr const char* NULL_DEVICE = "NUL";
+#else
+static constexpr const char* NULL_DEVICE = "/dev/null";
+#endif
+
+/**
+ * @brief UI that draws into the null device, so only composing and the write are measured
+ */
+struct NullUI {
+    FILE* sink = std::fopen(NULL_DEVICE, "wb");  ///< Null device
+    RoundUI ui{fileno(sink)};                     ///< UI writing to it
+
+    ~NullUI() { std::fclose(sink); }
+};
+
+/**
+ * @brief Reports bytes written and heap allocations per frame
+ * @param state Benchmark state
+ * @param ui UI that drew the frames
+ * @param allocationsBefore Allocation count before the loop
+ */
+static void reportFrames(BenchState& state, const RoundUI& ui, uint64_t allocationsBefore) {
+    const double frames = static_cast<double>(state.getIterations());
+    state.setCounter("bytes/frame", static_cast<double>(ui.getBytesWritten()) / frames);
+    state.setCounter("allocs/frame", static_cast<double>(benchAllocationCount() - allocationsBefore) / frames);
+}
+
+/**
+ * @brief One slots animation frame (reels and info box), diffed against the last one
+ * @param state Benchmark state
+ */
+static void RenderSlotsFrame(BenchState& state) {
+    NullUI null;
+    const std::vector<MeasuredText> measured(TextRes::SLOT_SYMBOLS.begin(), TextRes::SLOT_SYMBOLS.end());
+    std::vector<MeasuredText> symbols = {measured[0], measured[1], measured[2]};
+    const std::vector<std::string> info = {"Player's Balance: 5000", "Current bet: 100", "SPINNING..."};
+    size_t frame = 0;
+
+    const uint64_t allocationsBefore = benchAllocationCount();
+    while (state.keepRunning()) {
+        symbols[frame % 3] = measured[frame % measured.size()];
+        ++frame;
+
+        null.ui.beginFrame();
+        null.ui.renderSlots(symbols);
+        null.ui.drawBox("", info);
+        null.ui.presentFrame();
+    }
+    reportFrames(state, null.ui, allocationsBefore);
+}
+
+/**
+ * @brief One roulette animation frame (wheel and info box), diffed against the last one
+ * @param state Benchmark state
+ */
+static void RenderWheelFrame(BenchState& state) {
+    NullUI null;
+    std::vector<RouletteTile> wheel;
+    for (int number = 0; number < 37; ++number) {
+        const auto color = number == 0 ? RouletteTileType::GREEN
+                         : number % 2 ? RouletteTileType::RED : RouletteTileType::BLACK;
+        wheel.push_back(RouletteTile{color, number});
+    }
+    const std::vector<std::string> info = {"Player's Balance: 5000", "Bets: 3 (stake 300$)", "", "Spinning the wheel..."};
+    int tile = 0;
+
+    const uint64_t allocationsBefore = benchAllocationCount();
+    while (state.keepRunning()) {
+        null.ui.beginFrame();
+        null.ui.renderWheel(wheel, tile);
+        null.ui.drawBox("", info);
+        null.ui.presentFrame();
+        tile = (tile + 1) % 37;
+    }
+    reportFrames(state, null.ui, allocationsBefore);
+}
+
+/**
+ * @brief A full 20-line box (menus, leaderboard) written with one call
+ * @param state Benchmark state
+ */
+static void RenderBox(BenchState& state) {
+    NullUI null;
+    std::vector<std::string> lines;
+    for (int i = 1; i <= 20; ++i) lines.push_back(std::to_string(i) + ". player" + std::to_string(i) + " - 5000$");
+
+    const uint64_t allocationsBefore = benchAllocationCount();
+    while (state.keepRunning()) {
+        null.ui.drawBox("LEADERBOARD", lines);
+    }
+    reportFrames(state, null.ui, allocationsBefore);
+}
+
+/**
+ * @brief Width of a typical info line, ASCII only
+ * @param state Benchmark state
+ */
+static void MeasureAsciiLine(BenchState& state) {
+    const std::string line = "Player's Balance: 5000$ - Current bet: 100$ - Last win: 250$";
+
+    while (state.keepRunning()) {
+        doNotOptimize(TextWidth::measure(line));
+    }
+    state.setItemsProcessed(state.getIterations() * line.size());
+}
+
+/**
+ * @brief Width of a payout table line with emoji
+ * @param state Benchmark state
+ */
+static void MeasureEmojiLine(BenchState& state) {
+    const std::string line = TextRes::SLOT_SYMBOLS[0] + " " + TextRes::SLOT_SYMBOLS[0] + " " +
+                             TextRes::SLOT_SYMBOLS[0] + "  ->  x50";
+
+    while (state.keepRunning()) {
+        doNotOptimize(TextWidth::measure(line));
+    }
+    state.setItemsProcessed(state.getIterations() * line.size());
+}
+
+/**
+ * @brief Terminal width lookup, done several times per drawn box
+ * @param state Benchmark state
+ */
+static void TerminalColumns(BenchState& state) {
+    while (state.keepRunning()) {
+        doNotOptimize(TerminalGeometry::columns());
+    }
+}
+
+KASYNO_BENCH(RenderSlotsFrame);
+KASYNO_BENCH(RenderWheelFrame);
+KASYNO_BENCH(RenderBox);
+KASYNO_BENCH(MeasureAsciiLine);
+KASYNO_BENCH(MeasureEmojiLine);
+KASYNO_BENCH(TerminalColumns);
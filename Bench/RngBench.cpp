@@ -0,0 +1,87 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include <vector>
+
+#include "Bench.h"
+#include "../Rng.h"
+
+/**
+ * @brief Per-call randInt() path, as used by the games
+ * @param state Benchmark state
+ * @param engine Engine to benchmark
+ */
+static void benchRandInt(BenchState& state, RngEngine engine) {
+    Rng rng(engine);
+    rng.reseed(42);
+
+    while (state.keepRunning()) {
+        int value = rng.randInt(1, 100);
+        doNotOptimize(value);
+    }
+}
+
+/**
+ * @brief Bulk fillInt() path, argument is the batch size
+ * @param state Benchmark state
+ * @param engine Engine to benchmark
+ */
+static void benchFillInt(BenchState& state, RngEngine engine) {
+    Rng rng(engine);
+    rng.reseed(42);
+    std::vector<int> values(static_cast<size_t>(state.arg()));
+
+    while (state.keepRunning()) {
+        rng.fillInt(values, 1, 100);
+        doNotOptimize(values.data());
+    }
+
+    state.setItemsProcessed(state.getIterations() * values.size());
+}
+
+static void RngRandIntMt(BenchState& state) { benchRandInt(state, RngEngine::MT19937_64); }
+static void RngRandIntXoshiro(BenchState& state) { benchRandInt(state, RngEngine::XOSHIRO256); }
+static void RngFillIntMt(BenchState& state) { benchFillInt(state, RngEngine::MT19937_64); }
+static void RngFillIntXoshiro(BenchState& state) { benchFillInt(state, RngEngine::XOSHIRO256); }
+
+static void RngRandBelowXoshiro(BenchState& state) {
+    Rng rng(RngEngine::XOSHIRO256);
+    rng.reseed(42);
+
+    while (state.keepRunning()) {
+        uint32_t value = rng.randBelow(100);
+        doNotOptimize(value);
+    }
+}
+
+static void RngRandDoubleXoshiro(BenchState& state) {
+    Rng rng(RngEngine::XOSHIRO256);
+    rng.reseed(42);
+
+    while (state.keepRunning()) {
+        double value = rng.randDouble(0.0, 1.0);
+        doNotOptimize(value);
+    }
+}
+
+static void RngFillDoubleXoshiro(BenchState& state) {
+    Rng rng(RngEngine::XOSHIRO256);
+    rng.reseed(42);
+    std::vector<double> values(static_cast<size_t>(state.arg()));
+
+    while (state.keepRunning()) {
+        rng.fillDouble(values, 0.0, 1.0);
+        doNotOptimize(values.data());
+    }
+
+    state.setItemsProcessed(state.getIterations() * values.size());
+}
+
+KASYNO_BENCH(RngRandIntMt);
+KASYNO_BENCH(RngRandIntXoshiro);
+KASYNO_BENCH(RngRandBelowXoshiro);
+KASYNO_BENCH(RngFillIntMt, 64, 1024, 16384);
+KASYNO_BENCH(RngFillIntXoshiro, 64, 1024, 16384);
+KASYNO_BENCH(RngRandDoubleXoshiro);
+KASYNO_BENCH(RngFillDoubleXoshiro, 1024);
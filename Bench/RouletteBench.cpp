@@ -0,0 +1,112 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "Bench.h"
+#include "../Games/RouletteRules.h"
+
+/// @brief Bet types the legacy switch knew about (red to high)
+constexpr int LEGACY_BET_TYPE_COUNT = 8;
+
+/**
+ * @brief Fills a table with random red-to-high and straight number bets
+ * @param count Number of bets
+ * @return std::vector<std::pair<RouletteBetType, int>> Bet type and chosen number
+ */
+static std::vector<std::pair<RouletteBetType, int>> randomBets(size_t count) {
+    Rng rng = Rng::forStream(7, 0);
+    std::vector<std::pair<RouletteBetType, int>> bets;
+    bets.reserve(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        auto type = static_cast<RouletteBetType>(rng.randInt(0, LEGACY_BET_TYPE_COUNT - 1));
+        bets.emplace_back(type, rng.randInt(0, RouletteRules::NUMBER_COUNT - 1));
+    }
+
+    return bets;
+}
+
+/**
+ * @brief Settlement used before coverage masks (switch + std::find over red numbers)
+ * @param state Benchmark state
+ */
+static void RouletteSettleLegacy(BenchState& state) {
+    static const std::array<int, 18> redNumbers = {
+        1, 3, 5, 7, 9, 12, 14, 16, 18,
+        19, 21, 23, 25, 27, 30, 32, 34, 36
+    };
+    auto colorOf = [](int number) {
+        if (number == 0) return RouletteTileType::GREEN;
+        return (std::find(redNumbers.begin(), redNumbers.end(), number) != redNumbers.end())
+                   ? RouletteTileType::RED
+                   : RouletteTileType::BLACK;
+    };
+
+    Rng rng = Rng::forStream(42, 0);
+    const auto bets = randomBets(static_cast<size_t>(state.arg()));
+    std::vector<int> payouts(bets.size());
+
+    while (state.keepRunning()) {
+        const int number = RouletteRules::spin(rng);
+        const RouletteTileType color = colorOf(number);
+
+        for (size_t i = 0; i < bets.size(); ++i) {
+            bool win = false;
+            switch (bets[i].first) {
+                case RouletteBetType::BET_RED:    win = color == RouletteTileType::RED; break;
+                case RouletteBetType::BET_BLACK:  win = color == RouletteTileType::BLACK; break;
+                case RouletteBetType::BET_GREEN:  win = color == RouletteTileType::GREEN; break;
+                case RouletteBetType::BET_NUMBER: win = number == bets[i].second; break;
+                case RouletteBetType::BET_ODD:    win = number != 0 && number % 2 == 1; break;
+                case RouletteBetType::BET_EVEN:   win = number != 0 && number % 2 == 0; break;
+                case RouletteBetType::BET_LOW:    win = number >= 1 && number <= 18; break;
+                case RouletteBetType::BET_HIGH:   win = number >= 19 && number <= 36; break;
+                default:                          break;
+            }
+            payouts[i] = win ? 10 * RouletteRules::payout(bets[i].first) : 0;
+        }
+        doNotOptimize(payouts.data());
+    }
+
+    state.setItemsProcessed(state.getIterations() * bets.size());
+}
+
+static void RouletteSettleMask(BenchState& state) {
+    Rng rng = Rng::forStream(42, 0);
+    std::vector<RouletteBet> bets;
+    for (const auto& [type, number] : randomBets(static_cast<size_t>(state.arg()))) {
+        bets.push_back(RouletteRules::makeBet(type, number, 10));
+    }
+    std::vector<int> payouts(bets.size());
+
+    while (state.keepRunning()) {
+        int64_t total = RouletteRules::settle(bets, RouletteRules::spin(rng), payouts);
+        doNotOptimize(total);
+        doNotOptimize(payouts.data());
+    }
+
+    state.setItemsProcessed(state.getIterations() * bets.size());
+}
+
+static void RouletteTotalPayoutMask(BenchState& state) {
+    Rng rng = Rng::forStream(42, 0);
+    std::vector<RouletteBet> bets;
+    for (const auto& [type, number] : randomBets(static_cast<size_t>(state.arg()))) {
+        bets.push_back(RouletteRules::makeBet(type, number, 10));
+    }
+
+    while (state.keepRunning()) {
+        int64_t total = RouletteRules::totalPayout(bets, RouletteRules::spin(rng));
+        doNotOptimize(total);
+    }
+
+    state.setItemsProcessed(state.getIterations() * bets.size());
+}
+
+KASYNO_BENCH(RouletteSettleLegacy, 4096);
+KASYNO_BENCH(RouletteSettleMask, 4096);
+KASYNO_BENCH(RouletteTotalPayoutMask, 4096);
@@ -0,0 +1,77 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include <vector>
+
+#include "Bench.h"
+#include "../Games/SlotsRules.h"
+
+/**
+ * @brief Symbol draw used before the alias table (randInt + ternary chain)
+ * @param state Benchmark state
+ */
+static void SlotsDrawSymbolLegacy(BenchState& state) {
+    Rng rng = Rng::forStream(42, 0);
+
+    while (state.keepRunning()) {
+        int chance = rng.randInt(1, 100);
+        int symbol = (chance <= 40) ? 0 : (chance <= 70) ? 1 : (chance <= 85) ? 2 :
+                     (chance <= 95) ? 3 : (chance <= 99) ? 4 : 5;
+        doNotOptimize(symbol);
+    }
+}
+
+static void SlotsDrawSymbolAlias(BenchState& state) {
+    Rng rng = Rng::forStream(42, 0);
+
+    while (state.keepRunning()) {
+        int symbol = SlotsRules::drawSymbol(rng);
+        doNotOptimize(symbol);
+    }
+}
+
+static void SlotsDrawSymbolAliasBatch(BenchState& state) {
+    Rng rng = Rng::forStream(42, 0);
+    const AliasSampler& sampler = SlotsRules::symbolSampler();
+    std::vector<int> symbols(static_cast<size_t>(state.arg()));
+
+    while (state.keepRunning()) {
+        sampler.sample(rng, symbols);
+        doNotOptimize(symbols.data());
+    }
+
+    state.setItemsProcessed(state.getIterations() * symbols.size());
+}
+
+/**
+ * @brief Full spin as SlotsEngine does it (three symbol draws)
+ * @param state Benchmark state
+ */
+static void SlotsSpin(BenchState& state) {
+    Rng rng = Rng::forStream(42, 0);
+
+    while (state.keepRunning()) {
+        auto reels = SlotsRules::spin(rng);
+        doNotOptimize(reels);
+    }
+}
+
+/**
+ * @brief Spin and payout, as SlotsEngine::resolveRound
+ * @param state Benchmark state
+ */
+static void SlotsSpinEvaluate(BenchState& state) {
+    Rng rng = Rng::forStream(42, 0);
+
+    while (state.keepRunning()) {
+        const SlotsOutcome outcome = SlotsRules::evaluate(SlotsRules::spin(rng));
+        doNotOptimize(outcome);
+    }
+}
+
+KASYNO_BENCH(SlotsDrawSymbolLegacy);
+KASYNO_BENCH(SlotsDrawSymbolAlias);
+KASYNO_BENCH(SlotsDrawSymbolAliasBatch, 1024);
+KASYNO_BENCH(SlotsSpin);
+KASYNO_BENCH(SlotsSpinEvaluate);
@@ -62,6 +62,10 @@ void Casino::run() {
             state = GameState::MAIN_MENU;
         }
     }
+
+    if (!FileHandler::flush()) {
+        ui.print("Warning: Some progress could not be saved to the leaderboard!");
+    }
 }
 
 GameState Casino::handleMainMenu() {
@@ -93,8 +97,14 @@ GameState Casino::handleMainMenu() {
 
                 try {
                     LeaderboardEntry entry{player->getName(), player->getBalance()};
-                    FileHandler::addEntry(entry);
-                    ui.print("Previous player saved to leaderboard.");
+                    FileHandler::queueEntry(entry);
+
+                    // Only claim the save once the writer has put it on the disk
+                    if (FileHandler::flush()) {
+                        ui.print("Previous player saved to leaderboard.");
+                    } else {
+                        ui.print("Warning: Failed to save previous player!");
+                    }
                 } catch (const std::exception& e) {
                     ui.print("Warning: Failed to save previous player!");
                 }
@@ -199,8 +209,20 @@ void Casino::checkLeaderboard() {
             case LeaderboardMenuOptions::LEADERBOARD_VIEW: {
                 ui.clear();
                 try {
-                    auto entries = FileHandler::loadLeaderboard("leaderboard.txt");
-                    ui.leaderboard("LEADERBOARD", entries);
+                    auto entries = FileHandler::topEntries(TextRes::LEADERBOARD_TOP_COUNT);
+                    ui.leaderboard(TextRes::LEADERBOARD_TITLE, entries);
+
+                    const size_t players = FileHandler::leaderboardSize();
+                    if (players > entries.size()) {
+                        ui.print("Showing " + std::to_string(entries.size()) + " of " +
+                                 std::to_string(players) + " players.");
+                    }
+
+                    if (player) {
+                        if (auto rank = FileHandler::rankOf(player->getName())) {
+                            ui.print("Your place: #" + std::to_string(*rank + 1));
+                        }
+                    }
                 } catch (const std::exception& e) {
                     ui.print("Error loading leaderboard!");
                     ui.print(std::string("Details: ") + e.what());
@@ -282,8 +304,13 @@ GameState Casino::handleCasinoMenu() {
             if (player) {
                 try {
                     LeaderboardEntry entry{player->getName(), player->getBalance()};
-                    FileHandler::addEntry(entry);
-                    ui.print("Your progress has been saved!");
+                    FileHandler::queueEntry(entry);
+
+                    if (FileHandler::flush()) {
+                        ui.print("Your progress has been saved!");
+                    } else {
+                        ui.print("Warning: Failed to save progress!");
+                    }
                 } catch (const std::exception& e) {
                     ui.print("Warning: Failed to save progress!");
                     ui.print(std::string("Details: ") + e.what());
@@ -318,7 +345,7 @@ GameState Casino::handleGameMenu() {
 
         try {
             LeaderboardEntry entry{player->getName(), player->getBalance()};
-            FileHandler::addEntry(entry);
+            FileHandler::queueEntry(entry);
         } catch (const std::exception& e) {
             ui.print("Error saving to leaderboard: " + std::string(e.what()));
         }
@@ -346,7 +373,7 @@ GameState Casino::handleGameMenu() {
                 if (player) {
                     try {
                         LeaderboardEntry entry{player->getName(), player->getBalance()};
-                        FileHandler::addEntry(entry);
+                        FileHandler::queueEntry(entry);
                     } catch (const std::exception&) {
                     }
                 }
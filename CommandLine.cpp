@@ -0,0 +1,59 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "CommandLine.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include <system_error>
+
+/**
+ * @brief Formats a range limit for error messages
+ * @param value Limit
+ * @return std::string Shortest readable form (3600, not 3600.000000)
+ */
+static std::string formatDecimal(double value) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%g", value);
+    return buffer;
+}
+
+uint64_t CommandLine::parseUnsigned(const std::string& option, const std::string& value, uint64_t max) {
+    uint64_t parsed = 0;
+    const char* end = value.data() + value.size();
+    const auto [last, error] = std::from_chars(value.data(), end, parsed);
+
+    if (error == std::errc::result_out_of_range || (error == std::errc() && last == end && parsed > max)) {
+        throw std::invalid_argument(
+            "Value for " + option + " is too large: '" + value + "' (at most " + std::to_string(max) + ")"
+        );
+    }
+
+    if (error != std::errc() || last != end) {
+        throw std::invalid_argument("Invalid value for " + option + ": '" + value + "'");
+    }
+
+    return parsed;
+}
+
+double CommandLine::parseDecimal(const std::string& option, const std::string& value, double min, double max) {
+    double parsed = 0.0;
+    const char* end = value.data() + value.size();
+    const auto [last, error] = std::from_chars(value.data(), end, parsed);
+
+    if (error != std::errc() || last != end || !std::isfinite(parsed)) {
+        throw std::invalid_argument("Invalid value for " + option + ": '" + value + "'");
+    }
+
+    if (parsed < min || parsed > max) {
+        throw std::invalid_argument(
+            "Value for " + option + " must be between " + formatDecimal(min) + " and " + formatDecimal(max) +
+            ": '" + value + "'"
+        );
+    }
+
+    return parsed;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file CommandLine.h
+ * @brief Option value parsing shared by the command line tools
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_COMMANDLINE_H
+#define KASYNO_COMMANDLINE_H
+
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+/**
+ * @class CommandLine
+ * @brief Parses option values of kasyno_sim, kasyno_bench, kasyno_server and kasyno_loadgen
+ */
+class CommandLine {
+    /**
+     * @brief Parses a whole option value as an unsigned number
+     * @param option Option name (for error messages)
+     * @param value Text to parse (digits only, no sign or spaces)
+     * @param max Largest accepted value
+     * @return uint64_t Parsed value
+     * @throws std::invalid_argument if value is not a number or exceeds max
+     */
+    static uint64_t parseUnsigned(const std::string& option, const std::string& value, uint64_t max);
+
+public:
+    /**
+     * @brief Parses a non-negative option value that fits in Number
+     * @param option Option name (for error messages)
+     * @param value Text to parse ("-1" is rejected, not wrapped)
+     * @return Number Parsed value
+     * @throws std::invalid_argument if value is not a number or does not fit in Number
+     */
+    template <std::integral Number>
+    static Number parseNumber(const std::string& option, const std::string& value) {
+        return static_cast<Number>(
+            parseUnsigned(option, value, static_cast<uint64_t>(std::numeric_limits<Number>::max()))
+        );
+    }
+
+    /**
+     * @brief Parses a finite decimal option value within a range
+     * @param option Option name (for error messages)
+     * @param value Text to parse ("nan" and "inf" are rejected)
+     * @param min Smallest accepted value
+     * @param max Largest accepted value
+     * @return double Parsed value
+     * @throws std::invalid_argument if value is not a finite number in [min, max]
+     */
+    static double parseDecimal(const std::string& option, const std::string& value, double min, double max);
+};
+
+#endif //KASYNO_COMMANDLINE_H
@@ -0,0 +1,148 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "DurableFile.h"
+
+#include <filesystem>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+/**
+ * @brief Writes data to a file descriptor and commits it to the disk
+ * @param path File path
+ * @param data Bytes to write
+ * @param flags Extra _open flags (_O_APPEND or _O_TRUNC)
+ * @return bool True on success
+ */
+static bool writeAndSync(const std::string& path, std::string_view data, int flags) {
+    const int fd = _open(path.c_str(), _O_WRONLY | _O_CREAT | _O_BINARY | flags, _S_IREAD | _S_IWRITE);
+    if (fd < 0) return false;
+
+    bool ok = true;
+    while (ok && !data.empty()) {
+        const int written = _write(fd, data.data(), static_cast<unsigned>(data.size()));
+        ok = written > 0;
+        if (ok) data.remove_prefix(static_cast<size_t>(written));
+    }
+
+    ok = ok && _commit(fd) == 0;
+    return _close(fd) == 0 && ok;
+}
+
+#else
+
+/**
+ * @brief Writes data to a file descriptor and flushes it to the disk
+ * @param path File path
+ * @param data Bytes to write
+ * @param flags Extra open flags (O_APPEND or O_TRUNC)
+ * @return bool True on success
+ */
+static bool writeAndSync(const std::string& path, std::string_view data, int flags) {
+    const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC | flags, 0644);
+    if (fd < 0) return false;
+
+    bool ok = true;
+    while (ok && !data.empty()) {
+        const ssize_t written = ::write(fd, data.data(), data.size());
+        if (written < 0 && errno == EINTR) continue;
+        ok = written > 0;
+        if (ok) data.remove_prefix(static_cast<size_t>(written));
+    }
+
+    ok = ok && ::fsync(fd) == 0;
+    return ::close(fd) == 0 && ok;
+}
+
+/**
+ * @brief Flushes a directory entry change (rename) to the disk
+ * @param path Path of a file in the directory
+ */
+static void syncParentDirectory(const std::string& path) {
+    std::filesystem::path parent = std::filesystem::path(path).parent_path();
+    if (parent.empty()) parent = ".";
+
+    const int fd = ::open(parent.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) return;
+    ::fsync(fd);
+    ::close(fd);
+}
+
+#endif
+
+bool DurableFile::append(const std::string& path, std::string_view data) {
+#ifdef _WIN32
+    return writeAndSync(path, data, _O_APPEND);
+#else
+    return writeAndSync(path, data, O_APPEND);
+#endif
+}
+
+bool DurableFile::replace(const std::string& path, std::string_view data) {
+    const std::string tempName = path + ".tmp";
+
+#ifdef _WIN32
+    if (!writeAndSync(tempName, data, _O_TRUNC)) return false;
+    return MoveFileExA(tempName.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    if (!writeAndSync(tempName, data, O_TRUNC)) return false;
+    if (::rename(tempName.c_str(), path.c_str()) != 0) return false;
+
+    syncParentDirectory(path);
+    return true;
+#endif
+}
+
+FileLock::FileLock(const std::string& path) {
+#ifdef _WIN32
+    handle = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                         nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        handle = nullptr;
+        return;
+    }
+
+    OVERLAPPED overlapped{};
+    locked = LockFileEx(handle, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped) != 0;
+#else
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) return;
+
+    int result;
+    do {
+        result = ::flock(fd, LOCK_EX);
+    } while (result != 0 && errno == EINTR);
+
+    locked = result == 0;
+#endif
+}
+
+FileLock::~FileLock() {
+#ifdef _WIN32
+    if (handle) {
+        if (locked) {
+            OVERLAPPED overlapped{};
+            UnlockFileEx(handle, 0, MAXDWORD, MAXDWORD, &overlapped);
+        }
+        CloseHandle(handle);
+    }
+#else
+    if (fd >= 0) {
+        if (locked) ::flock(fd, LOCK_UN);
+        ::close(fd);
+    }
+#endif
+}
@@ -0,0 +1,93 @@
+/**
+ * @file DurableFile.h
+ * @brief Crash-safe file writes and inter-process file locks
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_DURABLEFILE_H
+#define KASYNO_DURABLEFILE_H
+
+#include <string>
+#include <string_view>
+
+/**
+ * @class DurableFile
+ * @brief File writes that survive a crash or power loss
+ *
+ * Data is flushed to the disk (fsync / _commit) before the call returns.
+ */
+class DurableFile {
+public:
+    /**
+     * @brief Appends data to a file and flushes it to the disk
+     * @param path File path (created if missing)
+     * @param data Bytes to append
+     * @return bool True if the data is on the disk
+     */
+    static bool append(const std::string& path, std::string_view data);
+
+    /**
+     * @brief Atomically replaces a file's contents
+     *
+     * Writes a temporary file next to it, flushes it, renames it over the
+     * old file and flushes the directory, so readers see either the old
+     * or the new contents, never a mix.
+     *
+     * @param path File path
+     * @param data New contents
+     * @return bool True if the new contents are in place
+     */
+    static bool replace(const std::string& path, std::string_view data);
+};
+
+/**
+ * @class FileLock
+ * @brief Exclusive advisory lock shared between processes (RAII)
+ *
+ * Blocks until the lock file is locked; unlocks in the destructor.
+ * Locks taken by the same process through different FileLock objects
+ * exclude each other too, so they must not be nested.
+ */
+class FileLock {
+private:
+#ifdef _WIN32
+    void* handle = nullptr;  ///< Windows file handle
+#else
+    int fd = -1;             ///< Lock file descriptor
+#endif
+    bool locked = false;     ///< Whether the lock is held
+
+public:
+    /**
+     * @brief Constructor - locks the file
+     * @param path Lock file path (created if missing)
+     */
+    explicit FileLock(const std::string& path);
+
+    /**
+     * @brief Destructor - releases the lock
+     */
+    ~FileLock();
+
+    FileLock(const FileLock&) = delete;
+    FileLock& operator=(const FileLock&) = delete;
+
+    /**
+     * @brief Checks if the lock is held
+     * @return bool True if locked (false if the lock file could not be opened)
+     */
+    bool isLocked() const { return locked; }
+
+    /**
+     * @brief Checks if the lock is held
+     * @return bool True if locked
+     */
+    explicit operator bool() const { return locked; }
+};
+
+#endif //KASYNO_DURABLEFILE_H
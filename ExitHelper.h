@@ -39,8 +39,10 @@ inline bool confirmExitAndSave(RoundUI& ui, Player& player) {
     ui.print("Exiting...");
 
     LeaderboardEntry entry{player.getName(), player.getBalance()};
+    FileHandler::queueEntry(entry);
 
-    if (FileHandler::addEntry(entry)) {
+    // Nothing queued may be lost on exit, so wait for the writer here
+    if (FileHandler::flush()) {
         ui.print("Your progress has been saved to the leaderboard!");
     } else {
         ui.print("Warning: Failed to save your progress!");
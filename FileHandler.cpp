@@ -3,9 +3,39 @@
 //
 
 #include "FileHandler.h"
+#include "LeaderboardWriter.h"
 #include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
-#include <algorithm>
+
+/**
+ * @brief Guards the stores, which the game thread and the writer thread share
+ */
+static std::mutex storesMutex;
+
+/**
+ * @brief Gets the open leaderboard stores
+ * @return std::unordered_map<...>& File path -> store
+ */
+static std::unordered_map<std::string, std::unique_ptr<LeaderboardStore>>& stores() {
+    static std::unordered_map<std::string, std::unique_ptr<LeaderboardStore>> instance;
+    return instance;
+}
+
+LeaderboardWriter& FileHandler::writer() {
+    // The stores are created first so they are destroyed after the
+    // writer has drained its queue into them
+    stores();
+
+    static LeaderboardWriter instance([](const std::string& filename, const std::vector<LeaderboardEntry>& batch) {
+        std::lock_guard<std::mutex> lock(storesMutex);
+        return store(filename).upsertBatch(batch);
+    });
+    return instance;
+}
 
 
 bool FileHandler::fileExists(const std::string& filename) {
@@ -13,98 +43,87 @@ bool FileHandler::fileExists(const std::string& filename) {
     return file.good();
 }
 
-bool FileHandler::saveLeaderboard(const std::vector<LeaderboardEntry>& entries, const std::string& filename) {
-    std::ofstream file(filename, std::ios::trunc);
-
-    if (!file.is_open()) return false;
-
-    for (const auto& entry : entries) {
-        file << entry.name << "||" << entry.balance << "\n";
+LeaderboardStore& FileHandler::store(const std::string& filename) {
+    auto it = stores().find(filename);
+    if (it == stores().end()) {
+        it = stores().emplace(filename, std::make_unique<LeaderboardStore>(filename)).first;
+    } else {
+        it->second->refresh();
     }
 
-    file.close();
+    return *it->second;
+}
 
-    return true;
+bool FileHandler::saveLeaderboard(const std::vector<LeaderboardEntry>& entries, const std::string& filename) {
+    writer().wait();
+    std::lock_guard<std::mutex> lock(storesMutex);
+    return store(filename).replace(entries);
 }
 
 bool FileHandler::addEntry(const LeaderboardEntry& entry, const std::string& filename) {
-    auto entries = loadLeaderboard(filename);
-
-    auto it = std::find_if(entries.begin(), entries.end(),
-        [&entry](const LeaderboardEntry& e) {
-            return e.name == entry.name;
-        });
+    writer().wait();
+    std::lock_guard<std::mutex> lock(storesMutex);
+    return store(filename).upsert(entry);
+}
 
-    if (it != entries.end()) {
-        it->balance = entry.balance;
-    } else {
-        entries.push_back(entry);
-    }
+void FileHandler::queueEntry(const LeaderboardEntry& entry, const std::string& filename) {
+    writer().submit(entry, filename);
+}
 
-    return saveLeaderboard(entries, filename);
+bool FileHandler::flush() {
+    return writer().flush();
 }
 
 std::vector<LeaderboardEntry> FileHandler::loadLeaderboard(const std::string& filename) {
-    std::vector<LeaderboardEntry> entries;
-
     if (!fileExists(filename)) {
         std::ofstream createFile(filename, std::ios::trunc);
         createFile.close();
-        return entries;
     }
 
-    std::ifstream file(filename);
-    if (!file.is_open()) return entries;
-
-    std::string line;
-    while (std::getline(file, line)) {
-        size_t pos = line.find("||");
-        if (pos != std::string::npos) {
-            try {
-                LeaderboardEntry entry;
-                entry.name = line.substr(0, pos);
-
-                int balance = std::stoi(line.substr(pos + 2));
-                if (balance >= 0) {
-                    entry.balance = balance;
-                    entries.push_back(entry);
-                }
-            } catch(...) {
-                continue;
-            }
-        }
-    }
+    writer().wait();
+    std::lock_guard<std::mutex> lock(storesMutex);
+    return store(filename).entries();
+}
 
-    file.close();
+std::vector<LeaderboardEntry> FileHandler::topEntries(size_t count, const std::string& filename) {
+    writer().wait();
+    std::lock_guard<std::mutex> lock(storesMutex);
+    return store(filename).range(0, count);
+}
 
-    std::sort(entries.begin(), entries.end(),
-        [](const LeaderboardEntry& a, const LeaderboardEntry& b) {
-            return a.balance > b.balance;  // Największy na górze
-        });
+std::vector<LeaderboardEntry> FileHandler::leaderboardPage(size_t page, size_t pageSize, const std::string& filename) {
+    if (pageSize != 0 && page > std::numeric_limits<size_t>::max() / pageSize) {
+        return {};
+    }
 
-    return entries;
+    writer().wait();
+    std::lock_guard<std::mutex> lock(storesMutex);
+    return store(filename).range(page * pageSize, pageSize);
 }
 
-bool FileHandler::playerExists(const std::string& playerName) {
-    auto entries = loadLeaderboard("leaderboard.txt");
+std::optional<size_t> FileHandler::rankOf(const std::string& playerName, const std::string& filename) {
+    writer().wait();
+    std::lock_guard<std::mutex> lock(storesMutex);
+    return store(filename).rankOf(playerName);
+}
 
-    for (const auto& entry : entries) {
-        if (entry.name == playerName) {
-            return true;
-        }
-    }
+size_t FileHandler::leaderboardSize(const std::string& filename) {
+    writer().wait();
+    std::lock_guard<std::mutex> lock(storesMutex);
+    return store(filename).size();
+}
 
-    return false;
+bool FileHandler::playerExists(const std::string& playerName, const std::string& filename) {
+    writer().wait();
+    std::lock_guard<std::mutex> lock(storesMutex);
+    return store(filename).contains(playerName);
 }
 
 bool FileHandler::clearLeaderboard(const std::string& filename) {
     try {
-        std::ofstream file(filename, std::ios::trunc);
-        if (!file.is_open()) {
-            return false;
-        }
-        file.close();
-        return true;
+        writer().wait();
+        std::lock_guard<std::mutex> lock(storesMutex);
+        return store(filename).clear();
     } catch (const std::exception&) {
         return false;
     }
@@ -12,17 +12,13 @@
 #ifndef KASYNO_FILEHANDLER_H
 #define KASYNO_FILEHANDLER_H
 
+#include <optional>
 #include <string>
 #include <vector>
 
-/**
- * @struct LeaderboardEntry
- * @brief Represents a single entry in the leaderboard
- */
-struct LeaderboardEntry {
-    std::string name;  ///< Player name
-    int balance;       ///< Player's final balance
-};
+#include "LeaderboardStore.h"
+
+class LeaderboardWriter;
 
 /**
  * @class FileHandler
@@ -32,9 +28,33 @@ struct LeaderboardEntry {
  * - Saving and loading leaderboard data
  * - Adding new entries
  * - Checking player existence
+ * - Top-K, page and rank queries
+ *
+ * Each file is opened once as a LeaderboardStore and kept in memory,
+ * so adding an entry appends a single line instead of rewriting the file.
+ *
+ * queueEntry() hands the write to a background thread so the game never
+ * waits for the disk; flush() waits for it. Every other method first
+ * waits for queued writes, so it sees them.
  */
 class FileHandler {
 private:
+    /**
+     * @brief Gets the store of a leaderboard file, up to date with the file
+     *
+     * The caller must hold the stores lock.
+     *
+     * @param filename Leaderboard file path
+     * @return LeaderboardStore& Store (lives until the program exits)
+     */
+    static LeaderboardStore& store(const std::string& filename);
+
+    /**
+     * @brief Gets the background writer behind queueEntry()
+     * @return LeaderboardWriter& Writer (flushed and stopped at program exit)
+     */
+    static LeaderboardWriter& writer();
+
     /**
      * @brief Checks if a file exists
      * @param filename Name of file to check
@@ -58,6 +78,23 @@ public:
      */
     static bool addEntry(const LeaderboardEntry& entry, const std::string& filename = "leaderboard.txt");
 
+    /**
+     * @brief Queues an entry to be written in the background
+     *
+     * Returns at once; several updates of one player before the write
+     * are merged into the latest. Call flush() to learn if it was saved.
+     *
+     * @param entry Leaderboard entry to add or update
+     * @param filename Leaderboard file path (default: "leaderboard.txt")
+     */
+    static void queueEntry(const LeaderboardEntry& entry, const std::string& filename = "leaderboard.txt");
+
+    /**
+     * @brief Waits until all queued entries are on the disk
+     * @return bool True if every queued write since the last flush succeeded
+     */
+    static bool flush();
+
     /**
      * @brief Loads leaderboard from file
      * @param filename Name of file to load from (default: "leaderboard.txt")
@@ -65,12 +102,46 @@ public:
      */
     static std::vector<LeaderboardEntry> loadLeaderboard(const std::string& filename = "leaderboard.txt");
 
+    /**
+     * @brief Gets the best players without loading the whole leaderboard
+     * @param count Number of players (e.g. 100 for the top 100)
+     * @param filename Leaderboard file path (default: "leaderboard.txt")
+     * @return std::vector<LeaderboardEntry> Highest balances first
+     */
+    static std::vector<LeaderboardEntry> topEntries(size_t count, const std::string& filename = "leaderboard.txt");
+
+    /**
+     * @brief Gets one page of the leaderboard
+     * @param page 0-based page number
+     * @param pageSize Players per page
+     * @param filename Leaderboard file path (default: "leaderboard.txt")
+     * @return std::vector<LeaderboardEntry> Entries of the page (empty past the end)
+     */
+    static std::vector<LeaderboardEntry> leaderboardPage(size_t page, size_t pageSize,
+                                                         const std::string& filename = "leaderboard.txt");
+
+    /**
+     * @brief Gets a player's position on the leaderboard in O(log n)
+     * @param playerName Player name
+     * @param filename Leaderboard file path (default: "leaderboard.txt")
+     * @return std::optional<size_t> 0-based rank, empty if the player is not on the leaderboard
+     */
+    static std::optional<size_t> rankOf(const std::string& playerName, const std::string& filename = "leaderboard.txt");
+
+    /**
+     * @brief Gets the number of players on the leaderboard
+     * @param filename Leaderboard file path (default: "leaderboard.txt")
+     * @return size_t Player count
+     */
+    static size_t leaderboardSize(const std::string& filename = "leaderboard.txt");
+
     /**
      * @brief Checks if a player with given name exists in leaderboard
      * @param playerName Name of player to check
+     * @param filename Leaderboard file path (default: "leaderboard.txt")
      * @return bool True if player exists, false otherwise
      */
-    static bool playerExists(const std::string& playerName);
+    static bool playerExists(const std::string& playerName, const std::string& filename = "leaderboard.txt");
 
     /**
      * @brief Clears all entries from the leaderboard file
@@ -0,0 +1,97 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "FrameBuilder.h"
+
+#include <charconv>
+#include <cstdio>
+#include <iostream>
+
+#include "Platform/Platform.h"
+
+static constexpr size_t COLOR_COUNT = static_cast<size_t>(AnsiColor::COUNT);
+
+/**
+ * @brief Builds the SGR sequence of one color combination
+ * @param fg Foreground color index
+ * @param bg Background color index
+ * @param bold Whether to use bold text
+ * @return AnsiSequence Sequence (empty for default colors without bold)
+ */
+static constexpr AnsiSequence makeSequence(size_t fg, size_t bg, bool bold) {
+    AnsiSequence sequence;
+    if (fg == 0 && bg == 0 && !bold) return sequence;
+
+    auto put = [&sequence](char c) { sequence.text[sequence.length++] = c; };
+    put('\x1b');
+    put('[');
+
+    bool first = true;
+    auto param = [&](char tens, char units) {
+        if (!first) put(';');
+        first = false;
+        if (tens) put(tens);
+        put(units);
+    };
+
+    // Colors after NONE map to 30-37 (foreground) and 40-47 (background)
+    if (bold) param(0, '1');
+    if (fg != 0) param('3', static_cast<char>('0' + fg - 1));
+    if (bg != 0) param('4', static_cast<char>('0' + bg - 1));
+
+    put('m');
+    return sequence;
+}
+
+/**
+ * @brief All sequences, indexed by bold, foreground and background
+ */
+static constexpr auto STYLES = [] {
+    std::array<AnsiSequence, 2 * COLOR_COUNT * COLOR_COUNT> styles{};
+    for (size_t bold = 0; bold < 2; ++bold) {
+        for (size_t fg = 0; fg < COLOR_COUNT; ++fg) {
+            for (size_t bg = 0; bg < COLOR_COUNT; ++bg) {
+                styles[(bold * COLOR_COUNT + fg) * COLOR_COUNT + bg] = makeSequence(fg, bg, bold != 0);
+            }
+        }
+    }
+    return styles;
+}();
+
+static_assert(STYLES[(1 * COLOR_COUNT + static_cast<size_t>(AnsiColor::WHITE)) * COLOR_COUNT +
+                     static_cast<size_t>(AnsiColor::RED)].view() == "\x1b[1;37;41m");
+
+std::string_view FrameBuilder::style(AnsiColor fg, AnsiColor bg, bool bold) {
+    const size_t index = ((bold ? 1 : 0) * COLOR_COUNT + static_cast<size_t>(fg)) * COLOR_COUNT + static_cast<size_t>(bg);
+    return STYLES[index].view();
+}
+
+void FrameBuilder::appendNumber(int64_t value) {
+    char digits[24];
+    auto [end, error] = std::to_chars(digits, digits + sizeof(digits), value);
+    bytes.append(digits, end);
+}
+
+void FrameBuilder::appendStyled(std::string_view text, AnsiColor fg, AnsiColor bg, bool bold) {
+    const std::string_view sequence = style(fg, bg, bold);
+    if (sequence.empty()) {
+        bytes.append(text);
+        return;
+    }
+
+    bytes.append(sequence);
+    bytes.append(text);
+    bytes.append(RESET);
+}
+
+bool FrameBuilder::writeTo(int fd) {
+    std::cout.flush();
+    std::fflush(stdout);
+
+    const size_t written = Platform::writeAll(fd, bytes.data(), bytes.size());
+    const bool ok = written == bytes.size();
+    totalWritten += written;
+    bytes.clear();
+    return ok;
+}
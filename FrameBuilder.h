@@ -0,0 +1,162 @@
+/**
+ * @file FrameBuilder.h
+ * @brief Reusable output arena for terminal frames with precomputed ANSI colors
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_FRAMEBUILDER_H
+#define KASYNO_FRAMEBUILDER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @enum AnsiColor
+ * @brief Terminal colors used by the UI
+ */
+enum class AnsiColor : uint8_t {
+    NONE = 0,  ///< Keep the terminal's default
+    BLACK,     ///< Black
+    RED,       ///< Red
+    GREEN,     ///< Green
+    YELLOW,    ///< Yellow
+    BLUE,      ///< Blue
+    MAGENTA,   ///< Magenta
+    CYAN,      ///< Cyan
+    WHITE,     ///< White
+    COUNT      ///< Number of entries
+};
+
+/**
+ * @struct AnsiSequence
+ * @brief SGR escape sequence stored inline (no allocation)
+ */
+struct AnsiSequence {
+    std::array<char, 12> text{};  ///< Sequence bytes, e.g. "\x1b[1;37;41m"
+    uint8_t length = 0;           ///< Used bytes
+
+    /**
+     * @brief Gets the sequence
+     * @return std::string_view Sequence bytes (empty for default colors)
+     */
+    constexpr std::string_view view() const { return {text.data(), length}; }
+};
+
+/**
+ * @class FrameBuilder
+ * @brief Byte arena a frame is composed in and written from with one system call
+ *
+ * clear() keeps the capacity, so after the first frames composing a frame
+ * does not allocate. Color sequences for every foreground, background and
+ * bold combination are built at compile time.
+ */
+class FrameBuilder {
+public:
+    static constexpr size_t INITIAL_CAPACITY = 16 * 1024;  ///< Arena bytes reserved up front
+    static constexpr std::string_view RESET = "\x1b[0m";    ///< Back to default colors
+
+private:
+    std::string bytes;            ///< Frame bytes
+    uint64_t totalWritten = 0;    ///< Bytes written by writeTo() so far
+
+public:
+    /**
+     * @brief Constructor - reserves the arena
+     */
+    FrameBuilder() { bytes.reserve(INITIAL_CAPACITY); }
+
+    /**
+     * @brief Gets the SGR sequence of a color combination
+     * @param fg Foreground color
+     * @param bg Background color
+     * @param bold Whether to use bold text
+     * @return std::string_view Sequence (empty for default colors without bold)
+     */
+    static std::string_view style(AnsiColor fg, AnsiColor bg, bool bold);
+
+    /**
+     * @brief Drops the contents, keeping the capacity
+     */
+    void clear() { bytes.clear(); }
+
+    /**
+     * @brief Appends text
+     * @param text Bytes to append
+     */
+    void append(std::string_view text) { bytes.append(text); }
+
+    /**
+     * @brief Appends one character
+     * @param c Character to append
+     */
+    void append(char c) { bytes.push_back(c); }
+
+    /**
+     * @brief Appends a character several times
+     * @param count Number of copies (negative counts as 0)
+     * @param c Character to repeat
+     */
+    void repeat(int count, char c = ' ') {
+        if (count > 0) bytes.append(static_cast<size_t>(count), c);
+    }
+
+    /**
+     * @brief Appends a number in decimal
+     * @param value Number to append
+     */
+    void appendNumber(int64_t value);
+
+    /**
+     * @brief Appends colored text followed by a reset
+     * @param text Text to color
+     * @param fg Foreground color
+     * @param bg Background color
+     * @param bold Whether to use bold text
+     */
+    void appendStyled(std::string_view text, AnsiColor fg, AnsiColor bg, bool bold);
+
+    /**
+     * @brief Gets the composed bytes
+     * @return std::string_view Frame bytes
+     */
+    std::string_view view() const { return bytes; }
+
+    /**
+     * @brief Gets the number of composed bytes
+     * @return size_t Byte count
+     */
+    size_t size() const { return bytes.size(); }
+
+    /**
+     * @brief Checks if nothing was composed
+     * @return bool True if empty
+     */
+    bool empty() const { return bytes.empty(); }
+
+    /**
+     * @brief Gets the number of bytes written so far
+     * @return uint64_t Bytes written by writeTo()
+     */
+    uint64_t getTotalWritten() const { return totalWritten; }
+
+    /**
+     * @brief Writes the whole frame with one write() call, then clears it
+     *
+     * Flushes std::cout and stdout first so earlier output stays in order.
+     * Retries only if the system writes part of the frame.
+     *
+     * @param fd File descriptor (1 = standard output)
+     * @return bool True if every byte was written
+     */
+    bool writeTo(int fd);
+};
+
+#endif //KASYNO_FRAMEBUILDER_H
@@ -0,0 +1,345 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "BlackjackEngine.h"
+
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+BlackjackEngine::BlackjackEngine(Rng& rng, int decks, double penetration): random(&rng), shoe(decks, penetration) {
+    shoe.shuffle(*random);
+}
+
+Card BlackjackEngine::drawCard() {
+    if (shoe.empty()) {
+        shoe.shuffle(*random);
+    }
+
+    return shoe.draw();
+}
+
+void BlackjackEngine::changeBalance(int amount) {
+    available += amount;
+    if (observer) observer->onBalanceChange(amount);
+}
+
+BlackjackRejectReason BlackjackEngine::checkAction(size_t handIndex, BlackjackRoundOptions action,
+                                                   bool firstAction) const {
+    const std::vector<Card>& hand = playerHands[handIndex];
+
+    switch (action) {
+        case BlackjackRoundOptions::HIT:
+        case BlackjackRoundOptions::STAND:
+            return BlackjackRejectReason::NONE;
+
+        case BlackjackRoundOptions::DOUBLE_DOWN:
+            if (!firstAction) return BlackjackRejectReason::NOT_FIRST_ACTION;
+            if (static_cast<long long>(handBets[handIndex]) * 2 > available) {
+                return BlackjackRejectReason::INSUFFICIENT_BALANCE;
+            }
+            return BlackjackRejectReason::NONE;
+
+        case BlackjackRoundOptions::SPLIT:
+            if (!firstAction) return BlackjackRejectReason::NOT_FIRST_ACTION;
+            if (hand.size() != 2) return BlackjackRejectReason::NOT_TWO_CARDS;
+            if (hand[0].value() != hand[1].value()) return BlackjackRejectReason::NOT_A_PAIR;
+            if (handBets[handIndex] > available) return BlackjackRejectReason::INSUFFICIENT_BALANCE;
+            return BlackjackRejectReason::NONE;
+
+        case BlackjackRoundOptions::SURRENDER:
+            if (!firstAction) return BlackjackRejectReason::NOT_FIRST_ACTION;
+            return BlackjackRejectReason::NONE;
+
+        default:
+            return BlackjackRejectReason::UNKNOWN_ACTION;
+    }
+}
+
+void BlackjackEngine::playHand(size_t handIndex, BlackjackPolicy& policy) {
+    bool firstAction = (playerHands[handIndex].size() == 2);
+
+    notify({BlackjackEventType::HAND_START, handIndex, Card{}, handTotal(playerHands[handIndex])});
+
+    while (true) {
+        // Re-read the hand every time, a split may grow the hand storage.
+        const std::vector<Card>& hand = playerHands[handIndex];
+
+        BlackjackDecision decision;
+        decision.hand = hand;
+        decision.dealerUpCard = dealerHand[0];
+        decision.handIndex = handIndex;
+        decision.handCount = handCount;
+        decision.total = handTotal(hand);
+        decision.handBet = handBets[handIndex];
+        decision.canDouble = checkAction(handIndex, BlackjackRoundOptions::DOUBLE_DOWN, firstAction) == BlackjackRejectReason::NONE;
+        decision.canSplit = checkAction(handIndex, BlackjackRoundOptions::SPLIT, firstAction) == BlackjackRejectReason::NONE;
+        decision.canSurrender = checkAction(handIndex, BlackjackRoundOptions::SURRENDER, firstAction) == BlackjackRejectReason::NONE;
+
+        const BlackjackRoundOptions action = policy.decide(decision);
+        const BlackjackRejectReason reason = checkAction(handIndex, action, firstAction);
+
+        if (reason != BlackjackRejectReason::NONE) {
+            BlackjackEvent rejected{BlackjackEventType::ACTION_REJECTED, handIndex, Card{}, decision.total};
+            rejected.action = action;
+            rejected.reason = reason;
+            notify(rejected);
+            continue;
+        }
+
+        ++result.actions[static_cast<int>(action)];
+
+        switch (action) {
+            case BlackjackRoundOptions::HIT: {
+                const Card newCard = drawCard();
+                playerHands[handIndex].push_back(newCard);
+
+                const int total = handTotal(playerHands[handIndex]);
+                const bool busted = total > 21;
+
+                BlackjackEvent hit{BlackjackEventType::HIT, handIndex, newCard, total};
+                hit.busted = busted;
+                notify(hit);
+
+                if (busted) {
+                    handDead[handIndex] = true;
+                    return;
+                }
+
+                firstAction = false;
+                continue;
+            }
+
+            case BlackjackRoundOptions::STAND: {
+                notify({BlackjackEventType::STAND, handIndex, Card{}, decision.total});
+                return;
+            }
+
+            case BlackjackRoundOptions::DOUBLE_DOWN: {
+                const int stake = handBets[handIndex];
+                changeBalance(-stake);
+                result.extraStake += stake;
+                handBets[handIndex] *= 2;
+
+                const Card newCard = drawCard();
+                playerHands[handIndex].push_back(newCard);
+
+                const int total = handTotal(playerHands[handIndex]);
+                const bool busted = total > 21;
+                handDead[handIndex] = busted;
+
+                BlackjackEvent doubled{BlackjackEventType::DOUBLE_DOWN, handIndex, newCard, total};
+                doubled.busted = busted;
+                notify(doubled);
+                return;
+            }
+
+            case BlackjackRoundOptions::SPLIT: {
+                if (playerHands.size() <= handCount) {
+                    playerHands.emplace_back();
+                }
+
+                std::vector<Card>& current = playerHands[handIndex];
+                std::vector<Card>& newHand = playerHands[handCount];
+                newHand.clear();
+
+                newHand.push_back(current.back());
+                current.pop_back();
+
+                current.push_back(drawCard());
+                newHand.push_back(drawCard());
+
+                const int stake = handBets[handIndex];
+                changeBalance(-stake);
+                result.extraStake += stake;
+
+                handBets.push_back(stake);
+                handDead.push_back(false);
+                ++handCount;
+
+                notify({BlackjackEventType::SPLIT, handIndex, Card{}, handTotal(current)});
+                firstAction = false;
+                continue;
+            }
+
+            case BlackjackRoundOptions::SURRENDER: {
+                const int refund = handBets[handIndex] / 2;
+                changeBalance(refund);
+                result.refund += refund;
+
+                handDead[handIndex] = true;
+                handBets[handIndex] = 0;
+
+                notify({BlackjackEventType::SURRENDER, handIndex, Card{}, decision.total});
+                return;
+            }
+        }
+    }
+}
+
+BlackjackRoundResult BlackjackEngine::playRound(int bet, int balance, BlackjackPolicy& policy,
+                                                BlackjackObserver* observer) {
+    if (bet <= 0) {
+        throw std::invalid_argument(
+            "BlackjackEngine::playRound: bet (" + std::to_string(bet) + ") must be positive"
+        );
+    }
+
+    if (balance < 0) {
+        throw std::invalid_argument(
+            "BlackjackEngine::playRound: balance (" + std::to_string(balance) + ") cannot be negative"
+        );
+    }
+
+    this->observer = observer;
+    result = BlackjackRoundResult{};
+    available = balance;
+
+    if (shoe.needsShuffle()) {
+        shoe.shuffle(*random);
+    }
+
+    if (playerHands.empty()) {
+        playerHands.emplace_back();
+    }
+
+    handCount = 1;
+    playerHands[0].clear();
+    handBets.assign(1, bet);
+    handDead.assign(1, false);
+    dealerHand.clear();
+
+    playerHands[0].push_back(drawCard());
+    playerHands[0].push_back(drawCard());
+    dealerHand.push_back(drawCard());
+
+    const int playerSum = handTotal(playerHands[0]);
+    notify({BlackjackEventType::ROUND_START, 0, Card{}, playerSum});
+
+    if (playerSum == 21) {
+        result.multiplier = 2.5;
+        result.end = BlackjackRoundEnd::PLAYER_BLACKJACK;
+        result.hands = 1;
+        result.handsWon = 1;
+        notify({BlackjackEventType::PLAYER_BLACKJACK, 0, Card{}, playerSum});
+        return result;
+    }
+
+    notify({BlackjackEventType::PLAYER_TURN, 0, Card{}, playerSum});
+
+    for (size_t i = 0; i < handCount; ++i) {
+        playHand(i, policy);
+    }
+
+    result.hands = static_cast<uint16_t>(handCount);
+
+    bool allDead = true;
+    for (size_t i = 0; i < handCount; ++i) {
+        if (!handDead[i]) {
+            allDead = false;
+            break;
+        }
+    }
+
+    if (allDead) {
+        result.end = BlackjackRoundEnd::ALL_HANDS_DEAD;
+        result.handsLost = result.hands;
+        notify({BlackjackEventType::ALL_HANDS_DEAD, 0, Card{}});
+        return result;
+    }
+
+    const Card secondCard = drawCard();
+    dealerHand.push_back(secondCard);
+    int dealerSum = handTotal(dealerHand);
+
+    notify({BlackjackEventType::DEALER_SECOND_CARD, 0, secondCard, dealerSum});
+
+    if (dealerSum == 21) {
+        result.end = BlackjackRoundEnd::DEALER_BLACKJACK;
+        result.handsLost = result.hands;
+        notify({BlackjackEventType::DEALER_BLACKJACK, 0, Card{}, dealerSum});
+        return result;
+    }
+
+    while (dealerSum < 17) {
+        const Card newCard = drawCard();
+        dealerHand.push_back(newCard);
+        dealerSum += newCard.value();
+
+        notify({BlackjackEventType::DEALER_HIT, 0, newCard, dealerSum});
+    }
+
+    notify({BlackjackEventType::DEALER_STANDS, 0, Card{}, dealerSum});
+
+    if (dealerSum > 21) {
+        result.end = BlackjackRoundEnd::DEALER_BUST;
+        notify({BlackjackEventType::DEALER_BUST, 0, Card{}, dealerSum});
+
+        for (size_t i = 0; i < handCount; ++i) {
+            if (handDead[i]) {
+                ++result.handsLost;
+            } else {
+                result.multiplier += 2.0;
+                ++result.handsWon;
+            }
+        }
+
+        return result;
+    }
+
+    result.end = BlackjackRoundEnd::SHOWDOWN;
+    const int dealerRange = std::abs(21 - dealerSum);
+
+    for (size_t i = 0; i < handCount; ++i) {
+        if (handDead[i]) {
+            ++result.handsLost;
+            continue;
+        }
+
+        const int sum = handTotal(playerHands[i]);
+        const int playerRange = std::abs(21 - sum);
+
+        if (playerRange < dealerRange) {
+            result.multiplier += 2.0;
+            ++result.handsWon;
+            notify({BlackjackEventType::HAND_WIN, i, Card{}, sum});
+        } else if (playerRange == dealerRange) {
+            result.multiplier += 1.0;
+            ++result.handsPushed;
+            notify({BlackjackEventType::HAND_PUSH, i, Card{}, sum});
+        } else {
+            ++result.handsLost;
+            notify({BlackjackEventType::HAND_LOSE, i, Card{}, sum});
+        }
+    }
+
+    return result;
+}
+
+RoundOutcome BlackjackEngine::resolveRound(const BetSlip& slip, Rng& rng) {
+    // rng drives reshuffles of this round only; the engine keeps its own generator
+    Rng* const previous = random;
+    random = &rng;
+
+    BlackjackRoundResult round;
+    try {
+        round = playRound(slip.stake, slip.available, strategy);
+    } catch (...) {
+        random = previous;
+        throw;
+    }
+    random = previous;
+
+    RoundOutcome outcome;
+    outcome.staked = static_cast<int64_t>(slip.stake) + round.extraStake;
+    outcome.paid = round.payout(slip.stake) + round.refund;
+    outcome.result = static_cast<int>(round.end);
+    return outcome;
+}
+
+int64_t BlackjackEngine::maxPayout(const BetSlip& slip) const {
+    const int64_t natural = static_cast<int64_t>(slip.stake) * 5 / 2;
+    const int64_t allHands = 2 * (static_cast<int64_t>(slip.stake) + slip.available);
+    return natural > allHands ? natural : allHands;
+}
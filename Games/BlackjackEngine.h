@@ -0,0 +1,279 @@
+/**
+ * @file BlackjackEngine.h
+ * @brief Headless blackjack rules engine
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_BLACKJACKENGINE_H
+#define KASYNO_BLACKJACKENGINE_H
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "BlackjackPolicy.h"
+#include "GameEngine.h"
+#include "Shoe.h"
+#include "../Rng.h"
+
+/**
+ * @enum BlackjackEventType
+ * @brief Things that happen during a round, in the order they happen
+ */
+enum class BlackjackEventType {
+    ROUND_START = 0,       ///< Initial cards dealt
+    PLAYER_BLACKJACK,      ///< Initial 21, round ends with 2.5x
+    PLAYER_TURN,           ///< Player starts playing the hands
+    HAND_START,            ///< A hand becomes the active one
+    HIT,                   ///< Hand drew a card (busted flag set if over 21)
+    STAND,                 ///< Hand stood
+    DOUBLE_DOWN,           ///< Hand doubled and drew a card (busted flag set if over 21)
+    SPLIT,                 ///< Hand was split
+    SURRENDER,             ///< Hand surrendered
+    ACTION_REJECTED,       ///< Chosen action is not allowed right now
+    ALL_HANDS_DEAD,        ///< Every hand busted or surrendered
+    DEALER_SECOND_CARD,    ///< Dealer drew the second card
+    DEALER_BLACKJACK,      ///< Dealer has 21 on two cards
+    DEALER_HIT,            ///< Dealer drew another card
+    DEALER_STANDS,         ///< Dealer finished drawing
+    DEALER_BUST,           ///< Dealer went over 21
+    HAND_WIN,              ///< Hand beat the dealer
+    HAND_PUSH,             ///< Hand tied with the dealer
+    HAND_LOSE,             ///< Hand lost to the dealer
+};
+
+/**
+ * @enum BlackjackRejectReason
+ * @brief Why an action was rejected
+ */
+enum class BlackjackRejectReason {
+    NONE = 0,              ///< Action was accepted
+    NOT_FIRST_ACTION,      ///< Double, split and surrender are first-action only
+    NOT_TWO_CARDS,         ///< Split needs exactly two cards
+    NOT_A_PAIR,            ///< Split needs two cards of the same value
+    INSUFFICIENT_BALANCE,  ///< Not enough money to double or split
+    UNKNOWN_ACTION,        ///< Action is not a valid option
+};
+
+/**
+ * @enum BlackjackRoundEnd
+ * @brief How a round was decided
+ */
+enum class BlackjackRoundEnd {
+    PLAYER_BLACKJACK = 0,  ///< Player's initial 21
+    ALL_HANDS_DEAD,        ///< All hands busted or surrendered
+    DEALER_BLACKJACK,      ///< Dealer's two-card 21
+    DEALER_BUST,           ///< Dealer busted
+    SHOWDOWN,              ///< Hands compared with the dealer
+};
+
+/**
+ * @struct BlackjackEvent
+ * @brief Single round event passed to observers
+ */
+struct BlackjackEvent {
+    BlackjackEventType type;                                        ///< What happened
+    size_t handIndex = 0;                                           ///< Hand the event refers to
+    Card card;                                                      ///< Card drawn (draw events only)
+    int total = 0;                                                  ///< Hand or dealer total after the event
+    bool busted = false;                                            ///< Hand went over 21 (HIT, DOUBLE_DOWN)
+    BlackjackRoundOptions action = BlackjackRoundOptions::HIT;      ///< Rejected action (ACTION_REJECTED)
+    BlackjackRejectReason reason = BlackjackRejectReason::NONE;     ///< Rejection reason (ACTION_REJECTED)
+};
+
+class BlackjackEngine;
+
+/**
+ * @class BlackjackObserver
+ * @brief Receives round events, e.g. to render them
+ */
+class BlackjackObserver {
+public:
+    virtual ~BlackjackObserver() = default;
+
+    /**
+     * @brief Called after every round event
+     * @param engine Engine with the current table state
+     * @param event Event details
+     */
+    virtual void onEvent(const BlackjackEngine& /*engine*/, const BlackjackEvent& /*event*/) {}
+
+    /**
+     * @brief Called when money moves during the round (double, split, surrender)
+     * @param amount Balance change (negative for extra stakes, positive for refunds)
+     */
+    virtual void onBalanceChange(int /*amount*/) {}
+};
+
+/**
+ * @struct BlackjackRoundResult
+ * @brief Outcome of a single round
+ */
+struct BlackjackRoundResult {
+    static constexpr int ACTION_COUNT = 5;  ///< Number of BlackjackRoundOptions values
+
+    double multiplier = 0.0;                          ///< Payout multiplier of the original bet (0 = lost)
+    int extraStake = 0;                               ///< Money taken by double-downs and splits
+    int refund = 0;                                   ///< Money returned by surrenders
+    BlackjackRoundEnd end = BlackjackRoundEnd::SHOWDOWN;  ///< How the round was decided
+    uint16_t hands = 0;                               ///< Number of hands played
+    uint16_t handsWon = 0;                            ///< Hands that beat the dealer
+    uint16_t handsPushed = 0;                         ///< Hands that tied
+    uint16_t handsLost = 0;                           ///< Hands that lost (busted, surrendered or beaten)
+    std::array<uint16_t, ACTION_COUNT> actions{};     ///< Accepted actions by BlackjackRoundOptions
+
+    /**
+     * @brief Money paid back for the original bet (same rounding as Player::winBet)
+     * @param bet Original bet
+     * @return int64_t Payout (splits and doubles can pay more than an int bet)
+     */
+    int64_t payout(int bet) const { return static_cast<int64_t>(bet * multiplier); }
+
+    /**
+     * @brief Net balance change of the round, including the original bet
+     * @param bet Original bet
+     * @return int64_t Net win (negative for a loss)
+     */
+    int64_t net(int bet) const { return payout(bet) - bet - extraStake + refund; }
+};
+
+/**
+ * @class BlackjackEngine
+ * @brief Plays blackjack rounds without any UI
+ *
+ * Implements the table rules used by BlackjackGame: the dealer gets one
+ * card up front and the second one only if some hand is still alive,
+ * Ace always counts 11, an initial 21 pays 2.5x, the dealer hits below 17
+ * and hands are compared by their distance from 21. Decisions come from
+ * a BlackjackPolicy, events go to an optional BlackjackObserver.
+ * As a GameEngine, rounds are played by basic strategy.
+ */
+class BlackjackEngine: public GameEngine {
+    Rng* random;                                    ///< Random number generator for shuffling
+    BasicStrategyPolicy strategy;                   ///< Policy of resolveRound()
+    Shoe shoe;                                      ///< Shoe the cards are dealt from
+    std::vector<std::vector<Card>> playerHands;     ///< Hand storage, reused between rounds
+    size_t handCount = 0;                           ///< Hands in play this round
+    std::vector<int> handBets;                      ///< Bet for each hand
+    std::vector<bool> handDead;                     ///< Hand busted or surrendered
+    std::vector<Card> dealerHand;                   ///< Dealer's hand
+    long long available = 0;                        ///< Money left for doubles and splits
+    BlackjackObserver* observer = nullptr;          ///< Observer of the current round
+    BlackjackRoundResult result;                    ///< Result of the current round
+
+    /**
+     * @brief Draws a card from the shoe (reshuffles if the shoe ran out)
+     * @return Card Drawn card
+     */
+    Card drawCard();
+
+    /**
+     * @brief Passes an event to the observer
+     * @param event Event to report
+     */
+    void notify(const BlackjackEvent& event) const {
+        if (observer) observer->onEvent(*this, event);
+    }
+
+    /**
+     * @brief Moves money and reports it to the observer
+     * @param amount Balance change
+     */
+    void changeBalance(int amount);
+
+    /**
+     * @brief Plays one hand until it stands, busts, doubles or surrenders
+     * @param handIndex Index of the hand
+     * @param policy Decision policy
+     */
+    void playHand(size_t handIndex, BlackjackPolicy& policy);
+
+    /**
+     * @brief Checks an action against the rules
+     * @param handIndex Index of the hand
+     * @param action Action to check
+     * @param firstAction Whether the hand has not acted yet
+     * @return BlackjackRejectReason NONE if the action is allowed
+     */
+    BlackjackRejectReason checkAction(size_t handIndex, BlackjackRoundOptions action, bool firstAction) const;
+
+public:
+    /**
+     * @brief Constructor - builds and shuffles the shoe
+     * @param rng Random number generator for shuffles (must outlive the engine)
+     * @param decks Number of decks in the shoe (1-8)
+     * @param penetration Fraction of the shoe dealt before the cut card
+     */
+    explicit BlackjackEngine(Rng& rng, int decks = 6, double penetration = 0.75);
+
+    /**
+     * @brief Plays a full round
+     * @param bet Original bet (already taken from the balance)
+     * @param balance Money left after the bet, limits doubles and splits
+     * @param policy Decision policy
+     * @param observer Optional event observer
+     * @return BlackjackRoundResult Round outcome
+     * @throws std::invalid_argument if bet is not positive or balance is negative
+     */
+    BlackjackRoundResult playRound(int bet, int balance, BlackjackPolicy& policy,
+                                   BlackjackObserver* observer = nullptr);
+
+    /**
+     * @brief Plays a full round by basic strategy
+     * @param slip Slip with the stake and the money left for doubles and splits
+     * @param rng Random number generator for reshuffles during this round only
+     *            (cards already in the shoe keep the order of an earlier shuffle)
+     * @return RoundOutcome Money result (result = BlackjackRoundEnd)
+     * @throws std::invalid_argument if the stake is not positive or available is negative
+     */
+    RoundOutcome resolveRound(const BetSlip& slip, Rng& rng) override;
+
+    /**
+     * @brief Gets the most a round can pay back
+     *
+     * An initial 21 pays 2.5x the stake; otherwise every hand pays at
+     * most 2x the stake and hands are only added by money from available.
+     * @param slip Slip with the stake and the money left for doubles and splits
+     * @return int64_t max(2.5 * stake, 2 * (stake + available))
+     */
+    int64_t maxPayout(const BetSlip& slip) const override;
+
+    /**
+     * @brief Sums card values (Ace counts 11)
+     * @param cards Cards to sum
+     * @return int Total
+     */
+    static int handTotal(std::span<const Card> cards) {
+        int total = 0;
+        for (const Card card : cards) total += card.value();
+        return total;
+    }
+
+    /**
+     * @brief Gets the player's hands of the current round
+     * @return std::span<const std::vector<Card>> Hands
+     */
+    std::span<const std::vector<Card>> getPlayerHands() const {
+        return std::span<const std::vector<Card>>(playerHands).first(handCount);
+    }
+
+    /**
+     * @brief Gets the dealer's hand of the current round
+     * @return const std::vector<Card>& Dealer's cards
+     */
+    const std::vector<Card>& getDealerHand() const { return dealerHand; }
+
+    /**
+     * @brief Gets the shoe
+     * @return const Shoe& Shoe
+     */
+    const Shoe& getShoe() const { return shoe; }
+};
+
+#endif //KASYNO_BLACKJACKENGINE_H
@@ -5,80 +5,13 @@
 #include "BlackjackGame.h"
 #include "../ExitHelper.h"
 
-BlackjackGame::BlackjackGame(Rng &rng): Game("Blackjack", rng),
-    lastScore(-1),
-    deck(initializeDeck()) {};
+BlackjackGame::BlackjackGame(Rng &rng, int decks, double penetration): Game("Blackjack", rng),
+    engine(rng, decks, penetration),
+    roundPlayer(nullptr),
+    lastScore(-1) {}
 
 BlackjackGame::~BlackjackGame() = default;
 
-std::vector<std::vector<Card>> BlackjackGame::initializeDeck() {
-    std::vector<std::vector<Card>> newDeck;
-
-    for (int suitIdx = 0; suitIdx < 4; suitIdx++) {
-        std::vector<Card> suitCards;
-        for (int rankIdx = 0; rankIdx < 13; rankIdx++) {
-            Card card;
-            card.suit = static_cast<Suit>(suitIdx);
-
-            switch (rankIdx) {
-                case 0:
-                    card.rank = "A";
-                    card.value = 11;
-                    break;
-                case 10: case 11: case 12:
-                    card.rank = (rankIdx == 10 ? "J" : (rankIdx == 11 ? "Q" : "K"));
-                    card.value = 10;
-                    break;
-                default:
-                    card.rank = std::to_string(rankIdx + 1);
-                    card.value = rankIdx + 1; break;
-            }
-            suitCards.push_back(card);
-        }
-        newDeck.push_back(suitCards);
-    }
-
-    return newDeck;
-}
-
-std::vector<std::vector<Card>> BlackjackGame::shuffleDeck() {
-    std::vector<Card> flatDeck;
-    for (const auto& suitCards : deck) {
-        flatDeck.insert(flatDeck.end(), suitCards.begin(), suitCards.end());
-    }
-
-    for (size_t i = flatDeck.size() - 1; i > 0; --i) {
-        size_t j = static_cast<size_t>(random.randInt(0, static_cast<int>(i)));
-        std::swap(flatDeck[i], flatDeck[j]);
-    }
-
-    std::vector<std::vector<Card>> shuffledDeck;
-    size_t cardsPerSuit = 13;
-
-    for (size_t i = 0; i < flatDeck.size(); i += cardsPerSuit) {
-        std::vector<Card> suitCards(
-            flatDeck.begin() + i,
-            flatDeck.begin() + std::min(i + cardsPerSuit,
-            flatDeck.size()));
-        shuffledDeck.push_back(suitCards);
-    }
-
-    return shuffledDeck;
-}
-
-Card BlackjackGame::drawCard() {
-    for (auto& suitCards : deck) {
-        if (!suitCards.empty()) {
-            Card drawnCard = suitCards.back();
-            suitCards.pop_back();
-            return drawnCard;
-        }
-    }
-
-    deck = shuffleDeck();
-    return drawCard();
-}
-
 int BlackjackGame::askForBet(Player& player) {
     RoundUI::clear();
 
@@ -228,9 +161,10 @@ void BlackjackGame::renderRound(const Player &player, bool playerTurn, const std
 
     std::string dealersHandStr = "Dealer's Hand: ";
     int dealersSum = 0;
-    for (const auto& card : dealerHand) {
-        dealersHandStr += card.rank + " ";
-        dealersSum += card.value;
+    for (const auto& card : engine.getDealerHand()) {
+        dealersHandStr += card.rank();
+        dealersHandStr += " ";
+        dealersSum += card.value();
     }
 
     dealersHandStr += " (" + std::to_string(dealersSum) + ")";
@@ -241,13 +175,14 @@ void BlackjackGame::renderRound(const Player &player, bool playerTurn, const std
     roundInfo.emplace_back("");
 
     size_t handIndex = 1;
-    for (const auto& hand : playerHand) {
+    for (const auto& hand : engine.getPlayerHands()) {
         int handSum = 0;
         std::string handStr = "Hand " + std::to_string(handIndex) + ": ";
 
         for (const auto& card : hand) {
-            handStr += card.rank + " ";
-            handSum += card.value;
+            handStr += card.rank();
+            handStr += " ";
+            handSum += card.value();
         }
 
         handStr += " (" + std::to_string(handSum) + ")";
@@ -274,266 +209,127 @@ void BlackjackGame::renderRound(const Player &player, bool playerTurn, const std
 }
 
 double BlackjackGame::handleRound(Player &player) {
-    deck = shuffleDeck();
+    roundPlayer = &player;
+    statusMessage.clear();
 
-    playerHand.clear();
-    handBets.clear();
-    dealerHand.clear();
-    surrendered.clear();
+    const BlackjackRoundResult result = engine.playRound(
+        player.getCurrentBet(), player.getBalance(), *this, this
+    );
 
-    playerHand.emplace_back();
-    auto &hand0 = playerHand[0];
-
-    hand0.push_back(drawCard());
-    hand0.push_back(drawCard());
-    dealerHand.push_back(drawCard());
+    roundPlayer = nullptr;
+    return result.multiplier;
+}
 
-    handBets.push_back(player.getCurrentBet());
-    surrendered.push_back(false);
+BlackjackRoundOptions BlackjackGame::decide(const BlackjackDecision &) {
+    renderRound(*roundPlayer, true, statusMessage);
+    statusMessage.clear();
 
-    std::string roundInfo = "Starting round.";
-    renderRound(player, true, roundInfo);
+    int option = ui.askChoice(TextRes::BLACKJACK_ROUND_OPTIONS_TITLE,
+                              TextRes::BLACKJACK_ROUND_OPTIONS,
+                              false);
 
-    int playerSum = hand0[0].value + hand0[1].value;
+    return static_cast<BlackjackRoundOptions>(option);
+}
 
-    if (playerSum == 21) {
-        roundInfo = "Blackjack! You win 2.5 times your bet.";
-        lastScore = static_cast<int>(player.getCurrentBet() * 2.5);
-        renderRound(player, false, roundInfo);
-        return 2.5;
+/**
+ * @brief Builds the message shown for a rejected action
+ * @param action Rejected action
+ * @param reason Rejection reason
+ * @return std::string Message for the player
+ */
+static std::string rejectMessage(BlackjackRoundOptions action, BlackjackRejectReason reason) {
+    switch (reason) {
+        case BlackjackRejectReason::NOT_FIRST_ACTION:
+            if (action == BlackjackRoundOptions::DOUBLE_DOWN) return "You can only double-down on your first action!";
+            if (action == BlackjackRoundOptions::SPLIT) return "You can only split on your first action!";
+            return "You can only surrender on your first action!";
+        case BlackjackRejectReason::NOT_TWO_CARDS:
+            return "You can only split your initial two cards";
+        case BlackjackRejectReason::NOT_A_PAIR:
+            return "You can only split a pair!";
+        case BlackjackRejectReason::INSUFFICIENT_BALANCE:
+            return action == BlackjackRoundOptions::DOUBLE_DOWN
+                ? "Insufficient balance to double-down!"
+                : "Insufficient balance to split!";
+        default:
+            return "Invalid choice, please try again.";
     }
+}
 
-    renderRound(player, true, roundInfo);
-
-    std::vector<bool> playerBusted;
-    playerBusted.reserve(2);
-    for (size_t i = 0; i < playerHand.size(); ++i) {
-        bool busted = playerTurn(player, i);
-        playerBusted.push_back(busted);
-    }
+void BlackjackGame::onEvent(const BlackjackEngine &, const BlackjackEvent &event) {
+    const Player &player = *roundPlayer;
 
-    bool allDead = true;
-    for (size_t i = 0; i < playerHand.size(); ++i) {
-        if (!playerBusted[i] && !surrendered[i]) {
-            allDead = false;
+    switch (event.type) {
+        case BlackjackEventType::ROUND_START:
+        case BlackjackEventType::PLAYER_TURN:
+            renderRound(player, true, "Starting round.");
             break;
-        }
-    }
-
-    if (allDead) {
-        roundInfo = "All your hands are either busted or surrendered.";
-        renderRound(player, false, roundInfo);
-        return 0.0;
-    }
-
-    dealerHand.push_back(drawCard());
-    int dealerSum = dealerHand[0].value + dealerHand[1].value;
-
-    roundInfo = "Dealer draws a second card.";
-    renderRound(player, false, roundInfo);
-
-    if (dealerSum == 21) {
-        roundInfo = "Dealer has Blackjack! You lose your bet.";
-        renderRound(player, false, roundInfo);
-        lastScore = 0;
-        return 0.0;
-    }
-
-    while (dealerSum < 17) {
-        Card newCard = drawCard();
-        dealerHand.push_back(newCard);
-        dealerSum += newCard.value;
-
-        roundInfo = "Dealer draws a card.";
-        renderRound(player, false, roundInfo);
-    }
-
-    roundInfo = "Dealer stands on " + std::to_string(dealerSum) + ".";
-    renderRound(player, false, roundInfo);
-
-    if (dealerSum > 21) {
-        roundInfo = "Dealer busted! All non-busted hands win even money.";
-        renderRound(player, false, roundInfo);
-
-        double totalMultiplier = 0.0;
-        for (size_t i = 0; i < playerHand.size(); ++i) {
-            if (!playerBusted[i] && !surrendered[i]) {
-                totalMultiplier += 2.0;  // Win: ×2
+        case BlackjackEventType::PLAYER_BLACKJACK:
+            lastScore = static_cast<int>(player.getCurrentBet() * 2.5);
+            renderRound(player, false, "Blackjack! You win 2.5 times your bet.");
+            break;
+        case BlackjackEventType::HAND_START:
+            statusMessage = "Playing hand " + std::to_string(event.handIndex + 1) + ".";
+            break;
+        case BlackjackEventType::HIT:
+            if (event.busted) {
+                renderRound(player, false, "You drew " + std::string(event.card.rank()) + " and busted!");
+            } else {
+                statusMessage = "You drew " + std::string(event.card.rank()) + ".";
             }
-        }
-
-        return totalMultiplier;
-    }
-
-    double totalMultiplier = 0.0;
-
-    for (size_t i = 0; i < playerHand.size(); ++i) {
-        if (playerBusted[i] || surrendered[i]) {
-            continue;
-        }
-
-        int sum = 0;
-        for (auto &c : playerHand[i]) sum += c.value;
-
-
-        int playerRange = abs(21 - sum);
-        int dealerRange = abs(21 - dealerSum);
-
-        if (playerRange < dealerRange) {
-            roundInfo = "One of your hands wins!";
-            totalMultiplier += 2.0;
-        } else if (playerRange == dealerRange) {
-            roundInfo = "One of your hands pushes.";
-            totalMultiplier += 1.0;
-        } else {
-            roundInfo = "One of your hands loses.";
-        }
-
-        renderRound(player, false, roundInfo);
+            break;
+        case BlackjackEventType::STAND:
+            renderRound(player, false, "You chose to stand.");
+            break;
+        case BlackjackEventType::DOUBLE_DOWN:
+            if (event.busted) {
+                renderRound(player, false, "You doubled-down, drew " + std::string(event.card.rank()) + " and busted!");
+            } else {
+                renderRound(player, false, "You doubled-down and drew " + std::string(event.card.rank()) + ".");
+            }
+            break;
+        case BlackjackEventType::SPLIT:
+            statusMessage = "You split your hand.";
+            break;
+        case BlackjackEventType::SURRENDER:
+            renderRound(player, false, "You surrendered this hand and got half your bet back.");
+            break;
+        case BlackjackEventType::ACTION_REJECTED:
+            statusMessage = rejectMessage(event.action, event.reason);
+            break;
+        case BlackjackEventType::ALL_HANDS_DEAD:
+            renderRound(player, false, "All your hands are either busted or surrendered.");
+            break;
+        case BlackjackEventType::DEALER_SECOND_CARD:
+            renderRound(player, false, "Dealer draws a second card.");
+            break;
+        case BlackjackEventType::DEALER_BLACKJACK:
+            lastScore = 0;
+            renderRound(player, false, "Dealer has Blackjack! You lose your bet.");
+            break;
+        case BlackjackEventType::DEALER_HIT:
+            renderRound(player, false, "Dealer draws a card.");
+            break;
+        case BlackjackEventType::DEALER_STANDS:
+            renderRound(player, false, "Dealer stands on " + std::to_string(event.total) + ".");
+            break;
+        case BlackjackEventType::DEALER_BUST:
+            renderRound(player, false, "Dealer busted! All non-busted hands win even money.");
+            break;
+        case BlackjackEventType::HAND_WIN:
+            renderRound(player, false, "One of your hands wins!");
+            break;
+        case BlackjackEventType::HAND_PUSH:
+            renderRound(player, false, "One of your hands pushes.");
+            break;
+        case BlackjackEventType::HAND_LOSE:
+            renderRound(player, false, "One of your hands loses.");
+            break;
     }
-
-    return totalMultiplier;
 }
 
-bool BlackjackGame::playerTurn(Player &player, size_t handIndex) {
-    auto &hand = playerHand[handIndex];
-    std::string statusMessage = "Playing hand " + std::to_string(handIndex + 1) + ".";
-
-    bool firstAction = (hand.size() == 2);
-
-    while (true) {
-        renderRound(player, true, statusMessage);
-        statusMessage.clear();
-
-        int option = ui.askChoice(TextRes::BLACKJACK_ROUND_OPTIONS_TITLE,
-                                  TextRes::BLACKJACK_ROUND_OPTIONS,
-                                  false);
-
-        auto choice = static_cast<BlackjackRoundOptions>(option);
-
-        switch (choice) {
-            case BlackjackRoundOptions::HIT: {
-                Card newCard = drawCard();
-                hand.push_back(newCard);
-
-                int sum = 0;
-                for (const auto &card : hand) sum += card.value;
-
-                if (sum > 21) {
-                    statusMessage = "You drew " + newCard.rank + " and busted!";
-                    renderRound(player, false, statusMessage);
-                    return true;
-                } else {
-                    statusMessage = "You drew " + newCard.rank + ".";
-                    firstAction = false;
-                    continue;
-                }
-            }
-
-            case BlackjackRoundOptions::STAND: {
-                statusMessage = "You chose to stand.";
-                renderRound(player, false, statusMessage);
-                return false;
-            }
-
-            case BlackjackRoundOptions::DOUBLE_DOWN: {
-                if (!firstAction) {
-                    statusMessage = "You can only double-down on your first action!";
-                    continue;
-                }
-
-                int betForThisHand = handBets[handIndex];
-                if (betForThisHand * 2 > player.getBalance()) {
-                    statusMessage = "Insufficient balance to double-down!";
-                    continue;
-                }
-
-                player.updateBalance(-betForThisHand);
-                handBets[handIndex] *= 2;
-
-                Card newCard = drawCard();
-                hand.push_back(newCard);
-
-                int sum = 0;
-                for (const auto &card : hand) sum += card.value;
-
-                if (sum > 21) {
-                    statusMessage = "You doubled-down, drew " + newCard.rank + " and busted!";
-                    renderRound(player, false, statusMessage);
-                    return true;
-                }
-
-                statusMessage = "You doubled-down and drew " + newCard.rank + ".";
-                renderRound(player, false, statusMessage);
-                return false;
-            }
-
-            case BlackjackRoundOptions::SPLIT: {
-                if (!firstAction) {
-                    statusMessage = "You can only split on your first action!";
-                    continue;
-                }
-
-                if (hand.size() != 2) {
-                    statusMessage = "You can only split your initial two cards";
-                    continue;
-                }
-
-                if (hand[0].value != hand[1].value) {
-                    statusMessage = "You can only split a pair!";
-                    continue;
-                }
-
-                int betForThisHand = handBets[handIndex];
-                if (betForThisHand > player.getBalance()) {
-                    statusMessage = "Insufficient balance to split!";
-                    continue;
-                }
-
-                Card cardMoved = hand.back();
-                hand.pop_back();
-
-                std::vector<Card> newHand;
-                newHand.push_back(cardMoved);
-
-                hand.push_back(drawCard());
-                newHand.push_back(drawCard());
-
-                player.updateBalance(-betForThisHand);
-
-                handBets.push_back(betForThisHand);
-                surrendered.push_back(false);
-                playerHand.push_back(std::move(newHand));
-
-                statusMessage = "You split your hand.";
-                firstAction = false;
-                continue;
-            }
-
-            case BlackjackRoundOptions::SURRENDER: {
-                if (!firstAction) {
-                    statusMessage = "You can only surrender on your first action!";
-                    continue;
-                }
-
-                int betForThisHand = handBets[handIndex];
-                int refund = betForThisHand / 2;
-                player.updateBalance(refund);
-
-                surrendered[handIndex] = true;
-                handBets[handIndex] = 0;
-
-                statusMessage = "You surrendered this hand and got half your bet back.";
-                renderRound(player, false, statusMessage);
-                return true;
-            }
-
-            default: {
-                statusMessage = "Invalid choice, please try again.";
-                continue;
-            }
-        }
-    }
+void BlackjackGame::onBalanceChange(int amount) {
+    roundPlayer->updateBalance(amount);
 }
 
 GameState BlackjackGame::playRound(Player &player) {
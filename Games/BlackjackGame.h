@@ -11,29 +11,9 @@
 
 #ifndef KASYNO_BLACKJACKGAME_H
 #define KASYNO_BLACKJACKGAME_H
+#include "BlackjackEngine.h"
 #include "Game.h"
 
-/**
- * @enum Suit
- * @brief Card suits in a deck
- */
-enum Suit {
-    HEARTS,      ///< Hearts suit
-    DIAMONDS,    ///< Diamonds suit
-    CLUBS,       ///< Clubs suit
-    SPADES       ///< Spades suit
-};
-
-/**
- * @struct Card
- * @brief Represents a playing card
- */
-struct Card {
-    std::string rank;  ///< Card rank (A, 2-10, J, Q, K)
-    Suit suit;         ///< Card suit
-    int value;         ///< Card value for blackjack (1-11)
-};
-
 /**
  * @class BlackjackGame
  * @brief Implementation of European Blackjack game
@@ -43,15 +23,17 @@ struct Card {
  * - Multiple hands support after split
  * - Blackjack detection (3:2 payout)
  * - Dealer hits to 17
+ * - 1-8 deck shoe with a cut card
+ *
+ * The rules are played by BlackjackEngine, the game acts as its policy
+ * (asking the player for actions) and observer (rendering every event).
  */
-class BlackjackGame: public Game {
+class BlackjackGame: public Game, private BlackjackPolicy, private BlackjackObserver {
 private:
-    std::vector<std::vector<Card>> playerHand;  ///< Player's hands (can be multiple after split)
-    std::vector<int> handBets;                  ///< Bet for each hand
-    std::vector<Card> dealerHand;               ///< Dealer's hand
-    std::vector<bool> surrendered;              ///< Surrender status for each hand
+    BlackjackEngine engine;   ///< Rules engine holding the shoe and the hands
+    Player* roundPlayer;      ///< Player of the round in progress
+    std::string statusMessage;///< Message shown with the next action prompt
     int lastScore;            ///< Last round's score
-    std::vector<std::vector<Card>> deck;  ///< Deck of cards (multiple decks)
 
 
     /**
@@ -87,44 +69,43 @@ private:
     void renderRound(const Player &player, bool playerTurn, const std::string &winningInfo) const;
 
     /**
-   * @brief Handles a single blackjack round
-   * @param player Current player
-   * @return double Total payout multiplier (0.0 if lost)
-   */
-    double handleRound(Player& player);
-
-    /**
-     * @brief Handles player's turn for a specific hand
+     * @brief Handles a single blackjack round
      * @param player Current player
-     * @param handIndex Index of the hand being played
-     * @return bool True if player didn't bust, false otherwise
+     * @return double Total payout multiplier (0.0 if lost)
      */
-    bool playerTurn(Player& player, size_t handIndex);
+    double handleRound(Player& player);
 
     /**
-     * @brief Initializes a standard 52-card deck
-     * @return std::vector<std::vector<Card>> Initialized deck
+     * @brief Asks the player for the next action on a hand
+     * @param decision Current state of the hand
+     * @return BlackjackRoundOptions Chosen action
      */
-    static std::vector<std::vector<Card>> initializeDeck();
+    BlackjackRoundOptions decide(const BlackjackDecision& decision) override;
 
     /**
-     * @brief Shuffles the deck
-     * @return std::vector<std::vector<Card>> Shuffled deck
+     * @brief Renders a round event
+     * @param engine Engine with the current table state
+     * @param event Event details
      */
-    std::vector<std::vector<Card>> shuffleDeck();
+    void onEvent(const BlackjackEngine& engine, const BlackjackEvent& event) override;
 
     /**
-     * @brief Draws a card from the deck
-     * @return Card Drawn card
+     * @brief Applies extra stakes and refunds to the round's player
+     * @param amount Balance change
      */
-    Card drawCard();
+    void onBalanceChange(int amount) override;
 
 public:
+    static constexpr int DEFAULT_DECKS = 6;               ///< Decks in the shoe by default
+    static constexpr double DEFAULT_PENETRATION = 0.75;   ///< Part of the shoe dealt before reshuffling
+
     /**
      * @brief Constructor
      * @param rng Reference to random number generator
+     * @param decks Number of decks in the shoe (1-8)
+     * @param penetration Fraction of the shoe dealt before the cut card
      */
-    explicit BlackjackGame(Rng &rng);
+    explicit BlackjackGame(Rng &rng, int decks = DEFAULT_DECKS, double penetration = DEFAULT_PENETRATION);
 
     /**
      * @brief Destructor
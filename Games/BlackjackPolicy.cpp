@@ -0,0 +1,115 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "BlackjackPolicy.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+char BlackjackStrategyTable::totalMove(int total, int upCard) const {
+    const int row = std::clamp(total, MIN_TOTAL, MAX_TOTAL) - MIN_TOTAL;
+    return totals[row][upCard - MIN_UP_CARD];
+}
+
+bool BlackjackStrategyTable::shouldSplit(int pairValue, int upCard) const {
+    return pairs[pairValue - MIN_UP_CARD][upCard - MIN_UP_CARD] == 'P';
+}
+
+BlackjackStrategyTable BlackjackStrategyTable::standard() {
+    // Dealer up card:     2 3 4 5 6 7 8 9 T A
+    static constexpr const char* TOTALS[TOTAL_COUNT] = {
+        "HHHHHHHHHH",  // 4
+        "HHHHHHHHHH",  // 5
+        "HHHHHHHHHH",  // 6
+        "HHHHHHHHHH",  // 7
+        "HHHHHHHHHH",  // 8
+        "HDDDDHHHHH",  // 9
+        "DDDDDDDDHH",  // 10
+        "DDDDDDDDDH",  // 11
+        "HHSSSHHHHH",  // 12
+        "SSSSSHHHHH",  // 13
+        "SSSSSHHHHH",  // 14
+        "SSSSSHHHRH",  // 15
+        "SSSSSHHRRR",  // 16
+        "SSSSSSSSSS",  // 17
+        "SSSSSSSSSS",  // 18
+        "SSSSSSSSSS",  // 19
+        "SSSSSSSSSS",  // 20
+        "SSSSSSSSSS",  // 21
+        "SSSSSSSSSS",  // 22 (A + A)
+    };
+
+    static constexpr const char* PAIRS[PAIR_COUNT] = {
+        "PPPPPP----",  // 2-2
+        "PPPPPP----",  // 3-3
+        "---PP-----",  // 4-4
+        "----------",  // 5-5
+        "PPPPP-----",  // 6-6
+        "PPPPPP----",  // 7-7
+        "PPPPPPPPPP",  // 8-8
+        "PPPPP-PP--",  // 9-9
+        "----------",  // 10-10
+        "PPPPPPPPPP",  // A-A
+    };
+
+    BlackjackStrategyTable table;
+    for (int row = 0; row < TOTAL_COUNT; ++row) {
+        std::copy_n(TOTALS[row], UP_CARD_COUNT, table.totals[row].begin());
+    }
+    for (int row = 0; row < PAIR_COUNT; ++row) {
+        std::copy_n(PAIRS[row], UP_CARD_COUNT, table.pairs[row].begin());
+    }
+
+    return table;
+}
+
+BasicStrategyPolicy::BasicStrategyPolicy(const BlackjackStrategyTable& table): table(table) {}
+
+BlackjackRoundOptions BasicStrategyPolicy::decide(const BlackjackDecision& decision) {
+    const int upCard = decision.dealerUpCard.value();
+
+    if (decision.canSplit && table.shouldSplit(decision.hand[0].value(), upCard)) {
+        return BlackjackRoundOptions::SPLIT;
+    }
+
+    switch (table.totalMove(decision.total, upCard)) {
+        case 'S':
+            return BlackjackRoundOptions::STAND;
+        case 'D':
+            return decision.canDouble ? BlackjackRoundOptions::DOUBLE_DOWN : BlackjackRoundOptions::HIT;
+        case 'd':
+            return decision.canDouble ? BlackjackRoundOptions::DOUBLE_DOWN : BlackjackRoundOptions::STAND;
+        case 'R':
+            return decision.canSurrender ? BlackjackRoundOptions::SURRENDER : BlackjackRoundOptions::HIT;
+        case 'r':
+            return decision.canSurrender ? BlackjackRoundOptions::SURRENDER : BlackjackRoundOptions::STAND;
+        default:
+            return BlackjackRoundOptions::HIT;
+    }
+}
+
+CallbackPolicy::CallbackPolicy(std::function<BlackjackRoundOptions(const BlackjackDecision&)> callback)
+    : callback(std::move(callback)) {
+    if (!this->callback) {
+        throw std::invalid_argument("CallbackPolicy::CallbackPolicy: callback cannot be empty");
+    }
+}
+
+BlackjackRoundOptions CallbackPolicy::decide(const BlackjackDecision& decision) {
+    return callback(decision);
+}
+
+ScriptedPolicy::ScriptedPolicy(std::vector<BlackjackRoundOptions> script): script(std::move(script)) {}
+
+BlackjackRoundOptions ScriptedPolicy::decide(const BlackjackDecision&) {
+    if (next >= script.size()) {
+        throw std::logic_error(
+            "ScriptedPolicy::decide: script exhausted after " + std::to_string(script.size()) + " actions"
+        );
+    }
+
+    return script[next++];
+}
@@ -0,0 +1,170 @@
+/**
+ * @file BlackjackPolicy.h
+ * @brief Decision policies used by the headless blackjack engine
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_BLACKJACKPOLICY_H
+#define KASYNO_BLACKJACKPOLICY_H
+
+#include <array>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "Card.h"
+#include "../Resources/Enums.h"
+
+/**
+ * @struct BlackjackDecision
+ * @brief Everything a policy can see when it has to act on a hand
+ *
+ * The can* flags already include the balance checks, so a policy that
+ * respects them never gets its action rejected.
+ */
+struct BlackjackDecision {
+    std::span<const Card> hand;    ///< Cards of the hand being played
+    Card dealerUpCard;             ///< Dealer's only visible card
+    size_t handIndex = 0;          ///< Index of the hand being played
+    size_t handCount = 1;          ///< Number of hands in the round
+    int total = 0;                 ///< Current hand total
+    int handBet = 0;               ///< Bet riding on this hand
+    bool canDouble = false;        ///< Double-down is allowed
+    bool canSplit = false;         ///< Split is allowed
+    bool canSurrender = false;     ///< Surrender is allowed
+};
+
+/**
+ * @class BlackjackPolicy
+ * @brief Chooses player actions for the blackjack engine
+ */
+class BlackjackPolicy {
+public:
+    virtual ~BlackjackPolicy() = default;
+
+    /**
+     * @brief Chooses the next action for a hand
+     * @param decision Current state of the hand
+     * @return BlackjackRoundOptions Chosen action
+     * @note An illegal action is rejected and the policy is asked again
+     */
+    virtual BlackjackRoundOptions decide(const BlackjackDecision& decision) = 0;
+};
+
+/**
+ * @struct BlackjackStrategyTable
+ * @brief Strategy chart indexed by hand total (or pair) and dealer up card
+ *
+ * Moves are stored as chart letters:
+ * H = hit, S = stand, D = double (else hit), d = double (else stand),
+ * R = surrender (else hit), r = surrender (else stand).
+ * The pair chart only holds P (split) or '-' (play as a total).
+ */
+struct BlackjackStrategyTable {
+    static constexpr int MIN_TOTAL = 4;          ///< Lowest total a decision can see (2 + 2)
+    static constexpr int MAX_TOTAL = 22;         ///< Highest total a decision can see (A + A)
+    static constexpr int MIN_UP_CARD = 2;        ///< Lowest dealer up card value
+    static constexpr int UP_CARD_COUNT = 10;     ///< Dealer up card values 2-11
+    static constexpr int TOTAL_COUNT = MAX_TOTAL - MIN_TOTAL + 1;  ///< Rows of the totals chart
+    static constexpr int PAIR_COUNT = 10;        ///< Pair values 2-11
+
+    std::array<std::array<char, UP_CARD_COUNT>, TOTAL_COUNT> totals{};  ///< Moves by total
+    std::array<std::array<char, UP_CARD_COUNT>, PAIR_COUNT> pairs{};    ///< Split flags by pair value
+
+    /**
+     * @brief Gets the move for a total
+     * @param total Hand total (clamped to 4-22)
+     * @param upCard Dealer up card value (2-11)
+     * @return char Chart letter
+     */
+    char totalMove(int total, int upCard) const;
+
+    /**
+     * @brief Checks if a pair should be split
+     * @param pairValue Value of each card of the pair (2-11)
+     * @param upCard Dealer up card value (2-11)
+     * @return bool True if the chart says split
+     */
+    bool shouldSplit(int pairValue, int upCard) const;
+
+    /**
+     * @brief Textbook basic strategy adapted to the table rules (Ace always counts 11)
+     * @return BlackjackStrategyTable Chart
+     */
+    static BlackjackStrategyTable standard();
+};
+
+/**
+ * @class BasicStrategyPolicy
+ * @brief Plays by a strategy chart
+ */
+class BasicStrategyPolicy: public BlackjackPolicy {
+    BlackjackStrategyTable table;  ///< Chart being followed
+public:
+    /**
+     * @brief Constructor
+     * @param table Strategy chart (textbook chart by default)
+     */
+    explicit BasicStrategyPolicy(const BlackjackStrategyTable& table = BlackjackStrategyTable::standard());
+
+    BlackjackRoundOptions decide(const BlackjackDecision& decision) override;
+
+    /**
+     * @brief Gets the chart being followed
+     * @return const BlackjackStrategyTable& Chart
+     */
+    const BlackjackStrategyTable& getTable() const { return table; }
+};
+
+/**
+ * @class CallbackPolicy
+ * @brief Forwards decisions to a function
+ */
+class CallbackPolicy: public BlackjackPolicy {
+    std::function<BlackjackRoundOptions(const BlackjackDecision&)> callback;  ///< Decision function
+public:
+    /**
+     * @brief Constructor
+     * @param callback Decision function
+     * @throws std::invalid_argument if callback is empty
+     */
+    explicit CallbackPolicy(std::function<BlackjackRoundOptions(const BlackjackDecision&)> callback);
+
+    BlackjackRoundOptions decide(const BlackjackDecision& decision) override;
+};
+
+/**
+ * @class ScriptedPolicy
+ * @brief Replays a recorded list of actions
+ */
+class ScriptedPolicy: public BlackjackPolicy {
+    std::vector<BlackjackRoundOptions> script;  ///< Recorded actions
+    size_t next = 0;                            ///< Index of the next action
+public:
+    /**
+     * @brief Constructor
+     * @param script Actions in the order they are played
+     */
+    explicit ScriptedPolicy(std::vector<BlackjackRoundOptions> script);
+
+    /**
+     * @brief Replays the next recorded action
+     * @param decision Current state of the hand (ignored)
+     * @return BlackjackRoundOptions Recorded action
+     * @throws std::logic_error if the script is exhausted
+     */
+    BlackjackRoundOptions decide(const BlackjackDecision& decision) override;
+
+    /**
+     * @brief Gets the number of actions not played yet
+     * @return size_t Remaining actions
+     */
+    size_t remaining() const { return script.size() - next; }
+};
+
+#endif //KASYNO_BLACKJACKPOLICY_H
@@ -0,0 +1,87 @@
+/**
+ * @file Card.h
+ * @brief Compact one-byte playing card
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_CARD_H
+#define KASYNO_CARD_H
+
+#include <array>
+#include <cstdint>
+
+/**
+ * @enum Suit
+ * @brief Card suits in a deck
+ */
+enum Suit {
+    HEARTS,      ///< Hearts suit
+    DIAMONDS,    ///< Diamonds suit
+    CLUBS,       ///< Clubs suit
+    SPADES       ///< Spades suit
+};
+
+/**
+ * @struct Card
+ * @brief Playing card packed into a single byte (rank * 4 + suit)
+ *
+ * Rank index 0 is the Ace, 1-9 are cards 2-10, 10-12 are J, Q, K.
+ */
+struct Card {
+    static constexpr int RANK_COUNT = 13;  ///< Ranks per suit
+    static constexpr int SUIT_COUNT = 4;   ///< Suits per deck
+    static constexpr int DECK_SIZE = RANK_COUNT * SUIT_COUNT;  ///< Cards in a single deck
+
+    uint8_t code = 0;  ///< Packed rank and suit
+
+    /**
+     * @brief Creates a card
+     * @param rankIndex Rank index (0 = Ace ... 12 = King)
+     * @param suit Card suit
+     * @return Card Packed card
+     */
+    static constexpr Card make(int rankIndex, Suit suit) {
+        return Card{static_cast<uint8_t>(rankIndex * SUIT_COUNT + static_cast<int>(suit))};
+    }
+
+    /**
+     * @brief Gets the rank index
+     * @return int Rank index (0 = Ace ... 12 = King)
+     */
+    constexpr int rankIndex() const { return code / SUIT_COUNT; }
+
+    /**
+     * @brief Gets the suit
+     * @return Suit Card suit
+     */
+    constexpr Suit suit() const { return static_cast<Suit>(code % SUIT_COUNT); }
+
+    /**
+     * @brief Gets the blackjack value (Ace counts as 11)
+     * @return int Card value (2-11)
+     */
+    constexpr int value() const {
+        constexpr std::array<uint8_t, RANK_COUNT> VALUES = {11, 2, 3, 4, 5, 6, 7, 8, 9, 10, 10, 10, 10};
+        return VALUES[rankIndex()];
+    }
+
+    /**
+     * @brief Gets the rank label
+     * @return const char* Rank label (A, 2-10, J, Q, K)
+     */
+    constexpr const char* rank() const {
+        constexpr std::array<const char*, RANK_COUNT> LABELS = {
+            "A", "2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K"
+        };
+        return LABELS[rankIndex()];
+    }
+};
+
+static_assert(sizeof(Card) == 1, "Card must stay a single byte");
+
+#endif //KASYNO_CARD_H
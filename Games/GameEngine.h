@@ -0,0 +1,98 @@
+/**
+ * @file GameEngine.h
+ * @brief UI-free interface for resolving game rounds
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_GAMEENGINE_H
+#define KASYNO_GAMEENGINE_H
+
+#include <cstdint>
+#include <span>
+
+#include "RouletteBetSlip.h"
+#include "RouletteRules.h"
+#include "../Rng.h"
+
+/**
+ * @struct BetSlip
+ * @brief Everything staked on one round, for any game
+ *
+ * Slots and blackjack use stake (blackjack also available, for doubles
+ * and splits). Roulette uses bets; the slip does not own them.
+ */
+struct BetSlip {
+    int stake = 0;                      ///< Main bet (slots, blackjack)
+    int available = 0;                  ///< Money left after the stake (blackjack doubles and splits)
+    std::span<const RouletteBet> bets;  ///< Roulette bets (roulette only)
+
+    /**
+     * @brief Creates a slip with a single stake
+     * @param stake Money bet
+     * @param available Money left after the stake
+     * @return BetSlip Slip
+     */
+    static BetSlip single(int stake, int available = 0) { return BetSlip{stake, available, {}}; }
+
+    /**
+     * @brief Creates a slip from roulette bets
+     * @param slip Bets of the spin (must outlive the returned slip)
+     * @return BetSlip Slip
+     */
+    static BetSlip roulette(const RouletteBetSlip& slip) { return BetSlip{0, 0, slip.getBets()}; }
+};
+
+/**
+ * @struct RoundOutcome
+ * @brief Money result of one resolved round
+ *
+ * Game-specific details (reels, winning number, hands) stay in the
+ * engine until the next round.
+ */
+struct RoundOutcome {
+    int64_t staked = 0;   ///< Money bet, including blackjack doubles and splits
+    int64_t paid = 0;     ///< Money paid back, including returned stakes and refunds
+    int result = -1;      ///< Slots: matched symbol, roulette: winning number, blackjack: BlackjackRoundEnd
+
+    /**
+     * @brief Gets the net balance change
+     * @return int64_t paid - staked (negative for a loss)
+     */
+    int64_t net() const { return paid - staked; }
+};
+
+/**
+ * @class GameEngine
+ * @brief Rules of a game without any UI
+ *
+ * Servers, simulators and tests resolve rounds through this interface;
+ * the interactive games (Game subclasses) use the same engines and only
+ * add input and rendering on top.
+ */
+class GameEngine {
+public:
+    virtual ~GameEngine() = default;
+
+    /**
+     * @brief Plays one round
+     * @param slip Money staked
+     * @param rng Random number generator driving the round
+     * @return RoundOutcome Money result
+     * @throws std::invalid_argument if the slip is not valid for the game
+     */
+    virtual RoundOutcome resolveRound(const BetSlip& slip, Rng& rng) = 0;
+
+    /**
+     * @brief Gets the most a round with this slip can pay back
+     * @param slip Money staked
+     * @return int64_t Upper bound of RoundOutcome::paid
+     */
+    virtual int64_t maxPayout(const BetSlip& slip) const = 0;
+};
+
+#endif //KASYNO_GAMEENGINE_H
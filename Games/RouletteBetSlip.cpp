@@ -0,0 +1,37 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "RouletteBetSlip.h"
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+void RouletteBetSlip::add(RouletteBetType type, int number, int amount, int second) {
+    RouletteBet bet = RouletteRules::makeBet(type, number, amount, second);
+
+    if (totalStake + amount > std::numeric_limits<int>::max()) {
+        throw std::invalid_argument(
+            "RouletteBetSlip::add: total stake would exceed " + std::to_string(std::numeric_limits<int>::max())
+        );
+    }
+
+    bets.push_back(bet);
+    specs.push_back(RouletteBetSpec{type, number, second});
+    totalStake += amount;
+}
+
+void RouletteBetSlip::clear() {
+    bets.clear();
+    specs.clear();
+    totalStake = 0;
+}
+
+int64_t RouletteBetSlip::settle(int number, std::span<int> payouts) const {
+    return RouletteRules::settle(bets, number, payouts);
+}
+
+int64_t RouletteBetSlip::payout(int number) const {
+    return RouletteRules::totalPayout(bets, number);
+}
@@ -0,0 +1,107 @@
+/**
+ * @file RouletteBetSlip.h
+ * @brief Any number of roulette bets placed on one spin
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_ROULETTEBETSLIP_H
+#define KASYNO_ROULETTEBETSLIP_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "RouletteRules.h"
+
+/**
+ * @struct RouletteBetSpec
+ * @brief What the player picked on the layout (kept for display)
+ */
+struct RouletteBetSpec {
+    RouletteBetType type = RouletteBetType::BET_RED;  ///< Bet type
+    int number = -1;                                  ///< Chosen number (see RouletteRules::coverage)
+    int second = -1;                                  ///< Second number of a split
+};
+
+/**
+ * @class RouletteBetSlip
+ * @brief Bets of one player for one spin
+ *
+ * Bets are resolved to coverage masks when added, so settling the whole
+ * slip is a single pass over them with RouletteRules::settle().
+ */
+class RouletteBetSlip {
+private:
+    std::vector<RouletteBet> bets;       ///< Resolved bets
+    std::vector<RouletteBetSpec> specs;  ///< Layout choices, same order as bets
+    int64_t totalStake = 0;              ///< Sum of all amounts
+
+public:
+    /**
+     * @brief Adds a bet to the slip
+     * @param type Bet type
+     * @param number Chosen number (see RouletteRules::coverage)
+     * @param amount Money staked
+     * @param second Second number (BET_SPLIT only)
+     * @throws std::invalid_argument if the bet is invalid or the total stake would overflow
+     */
+    void add(RouletteBetType type, int number, int amount, int second = -1);
+
+    /**
+     * @brief Removes all bets
+     */
+    void clear();
+
+    /**
+     * @brief Checks if the slip has no bets
+     * @return bool True if empty
+     */
+    bool empty() const { return bets.empty(); }
+
+    /**
+     * @brief Gets the number of bets
+     * @return size_t Bet count
+     */
+    size_t size() const { return bets.size(); }
+
+    /**
+     * @brief Gets the money staked on all bets
+     * @return int Total stake
+     */
+    int getTotalStake() const { return static_cast<int>(totalStake); }
+
+    /**
+     * @brief Gets the resolved bets
+     * @return std::span<const RouletteBet> Bets in the order they were added
+     */
+    std::span<const RouletteBet> getBets() const { return bets; }
+
+    /**
+     * @brief Gets the layout choices
+     * @return std::span<const RouletteBetSpec> Specs in the order bets were added
+     */
+    std::span<const RouletteBetSpec> getSpecs() const { return specs; }
+
+    /**
+     * @brief Settles every bet against one spin
+     * @param number Winning number (0-36)
+     * @param payouts Output, money paid back for each bet (at least size() elements)
+     * @return int64_t Total money paid back
+     * @throws std::invalid_argument if payouts is too small or number is out of range
+     */
+    int64_t settle(int number, std::span<int> payouts) const;
+
+    /**
+     * @brief Totals the money paid back against one spin
+     * @param number Winning number (0-36)
+     * @return int64_t Total money paid back
+     */
+    int64_t payout(int number) const;
+};
+
+#endif //KASYNO_ROULETTEBETSLIP_H
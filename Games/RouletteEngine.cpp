@@ -0,0 +1,44 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "RouletteEngine.h"
+
+#include <array>
+#include <stdexcept>
+
+/**
+ * @brief Builds the position of every number on the wheel
+ * @return std::array<int, RouletteRules::NUMBER_COUNT> Index in WHEEL_ORDER by number
+ */
+static constexpr std::array<int, RouletteRules::NUMBER_COUNT> wheelPositions() {
+    std::array<int, RouletteRules::NUMBER_COUNT> positions{};
+    for (int i = 0; i < RouletteRules::NUMBER_COUNT; ++i) {
+        positions[RouletteRules::WHEEL_ORDER[i]] = i;
+    }
+    return positions;
+}
+
+static constexpr std::array<int, RouletteRules::NUMBER_COUNT> WHEEL_POSITIONS = wheelPositions();
+
+RoundOutcome RouletteEngine::resolveRound(const BetSlip& slip, Rng& rng) {
+    if (slip.bets.empty()) {
+        throw std::invalid_argument("RouletteEngine::resolveRound: no bets on the slip");
+    }
+
+    number = RouletteRules::spin(rng);
+    wheelIndex = WHEEL_POSITIONS[number];
+    payouts.resize(slip.bets.size());
+
+    RoundOutcome result;
+    for (const RouletteBet& bet : slip.bets) result.staked += bet.amount;
+    result.paid = RouletteRules::settle(slip.bets, number, payouts);
+    result.result = number;
+    return result;
+}
+
+int64_t RouletteEngine::maxPayout(const BetSlip& slip) const {
+    int64_t total = 0;
+    for (const RouletteBet& bet : slip.bets) total += bet.win;
+    return total;
+}
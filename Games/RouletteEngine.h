@@ -0,0 +1,64 @@
+/**
+ * @file RouletteEngine.h
+ * @brief Roulette spins without UI
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_ROULETTEENGINE_H
+#define KASYNO_ROULETTEENGINE_H
+
+#include <span>
+#include <vector>
+
+#include "GameEngine.h"
+
+/**
+ * @class RouletteEngine
+ * @brief Spins the wheel and settles the bets of a slip
+ */
+class RouletteEngine: public GameEngine {
+    int number = -1;            ///< Winning number of the last round
+    int wheelIndex = -1;        ///< Position of the number in RouletteRules::WHEEL_ORDER
+    std::vector<int> payouts;   ///< Payout of each bet in the last round (reused)
+public:
+    /**
+     * @brief Spins the wheel and settles every bet
+     * @param slip Slip with the roulette bets
+     * @param rng Random number generator
+     * @return RoundOutcome Money result (result = winning number)
+     * @throws std::invalid_argument if the slip has no bets
+     */
+    RoundOutcome resolveRound(const BetSlip& slip, Rng& rng) override;
+
+    /**
+     * @brief Gets the payout if every bet of the slip wins
+     * @param slip Slip with the roulette bets
+     * @return int64_t Sum of the bets' wins
+     */
+    int64_t maxPayout(const BetSlip& slip) const override;
+
+    /**
+     * @brief Gets the winning number of the last round
+     * @return int Number (0-36, -1 before the first round)
+     */
+    int getNumber() const { return number; }
+
+    /**
+     * @brief Gets where the winning number sits on the wheel
+     * @return int Index in RouletteRules::WHEEL_ORDER (-1 before the first round)
+     */
+    int getWheelIndex() const { return wheelIndex; }
+
+    /**
+     * @brief Gets what each bet paid in the last round
+     * @return std::span<const int> Payouts in slip order
+     */
+    std::span<const int> getPayouts() const { return payouts; }
+};
+
+#endif //KASYNO_ROULETTEENGINE_H
@@ -3,60 +3,27 @@
 //
 
 #include "RouletteGame.h"
-#include <array>
-#include <algorithm>
-#include <thread>
 #include <chrono>
 
+#include "../AnimationTimeline.h"
 #include "../ExitHelper.h"
 
-/// @brief Payout multipliers for each bet type
-constexpr std::array<int, 8> ROULETTE_PAYOUT_MULTIPLIERS = {
-    2,  // RED
-    2,  // BLACK
-    35, // GREEN
-    35, // NUMBER
-    2,  // ODD
-    2,  // EVEN
-    2,  // LOW
-    2   // HIGH
-};
-
 RouletteGame::RouletteGame(Rng &rng): Game("Roulette", rng),
     lastScore(-1),
-    betType(RouletteBetType::BET_RED),
-    betNumber(-1),
     wheel(initWheel()),
     spunTile(-1) {};
 
 RouletteGame::~RouletteGame() = default;
 
 RouletteTileType RouletteGame::getColorForNumber(int number) const {
-    if (number == 0) return RouletteTileType::GREEN;
-
-    static const std::array<int, 18> redNumbers = {
-        1, 3, 5, 7, 9, 12, 14, 16, 18,
-        19, 21, 23, 25, 27, 30, 32, 34, 36
-    };
-
-    return (std::find(redNumbers.begin(), redNumbers.end(), number) != redNumbers.end())
-               ? RouletteTileType::RED
-               : RouletteTileType::BLACK;
+    return RouletteRules::colorOf(number);
 }
 
 std::vector<RouletteTile> RouletteGame::initWheel() {
-    static const std::vector<int> numbers = {
-        0, 32, 15, 19, 4, 21, 2, 25,
-        17, 34, 6, 27, 13, 36, 11, 30,
-        8, 23, 10, 5, 24, 16, 33, 1,
-        20, 14, 31, 9, 22, 18, 29, 7,
-        28, 12, 35, 3, 26
-    };
-
     std::vector<RouletteTile> wheel;
-    wheel.reserve(numbers.size());
+    wheel.reserve(RouletteRules::WHEEL_ORDER.size());
 
-    for (int n : numbers) {
+    for (int n : RouletteRules::WHEEL_ORDER) {
         wheel.emplace_back(RouletteTile{
             getColorForNumber(n),
             n
@@ -66,10 +33,6 @@ std::vector<RouletteTile> RouletteGame::initWheel() {
     return wheel;
 }
 
-int RouletteGame::spinWheel() {
-    return random.randInt(0, static_cast<int>(wheel.size()) - 1);
-}
-
 void RouletteGame::animateSpin(const Player& player, int resultIndex) {
     int n = static_cast<int>(wheel.size());
     if (n == 0) return;
@@ -86,37 +49,103 @@ void RouletteGame::animateSpin(const Player& player, int resultIndex) {
     float minDelayMs = 15.0f;
     float MaxDelaysMs = 180.0f;
 
+    AnimationTimeline timeline;
     for (int step = 0; step <= totalSteps; ++step) {
-        int currentIndex = (startIndex + step) % n;
+        float t = (totalSteps > 0)
+                        ? static_cast<float>(step) / static_cast<float>(totalSteps)
+                        : 1.0f;
 
-        RoundUI::clear();
+        float delay = minDelayMs + (MaxDelaysMs - minDelayMs) * (t * t);
 
+        if (!timeline.nextFrame(std::chrono::milliseconds(static_cast<int>(delay)), step == totalSteps)) {
+            continue;
+        }
+
+        int currentIndex = (startIndex + step) % n;
+
+        ui.beginFrame();
         ui.renderWheel(wheel, currentIndex);
         std::vector<std::string> info;
         info.emplace_back(player.getName() + "'s Balance: " + std::to_string(player.getBalance()));
-        info.emplace_back("Current bet: " + std::to_string(player.getCurrentBet()) +
-                         "$ - " + TextRes::ROULETTE_BET_TYPES[static_cast<int>(betType)] +
-                         (betType == RouletteBetType::BET_NUMBER
-                              ? " (" + std::to_string(betNumber) + ")"
-                              : ""));
+        addSlipInfo(info);
         info.emplace_back("");
         info.emplace_back("Spinning the wheel...");
         ui.drawBox("", info);
+        ui.presentFrame();
+    }
+    timeline.finish();
 
-        float t = (totalSteps > 0)
-                        ? static_cast<float>(step) / static_cast<float>(totalSteps)
-                        : 1.0f;
+    spunTile = resultIndex;
+}
 
-        float delay = minDelayMs + (MaxDelaysMs - minDelayMs) * (t * t);
+void RouletteGame::askBetNumbers(RouletteBetType type, int& number, int& second) {
+    number = -1;
+    second = -1;
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(delay)));
+    while (true) {
+        switch (type) {
+            case RouletteBetType::BET_NUMBER:
+                number = ui.askInput("Enter the number you want to bet on (0-36): ", 0, 36);
+                break;
+            case RouletteBetType::BET_SPLIT:
+                number = ui.askInput("Enter the first number of the split (0-36): ", 0, 36);
+                second = ui.askInput("Enter the second number (next to the first on the table): ", 0, 36);
+                break;
+            case RouletteBetType::BET_STREET:
+                number = ui.askInput("Enter any number of the street (1-36): ", 1, 36);
+                break;
+            case RouletteBetType::BET_CORNER:
+                number = ui.askInput("Enter the lowest number of the corner (1-32, not 3, 6, 9...): ", 1, 32);
+                break;
+            case RouletteBetType::BET_SIX_LINE:
+                number = ui.askInput("Enter any number of the first street (1-33): ", 1, 33);
+                break;
+            case RouletteBetType::BET_DOZEN:
+                number = ui.askInput("Enter the dozen (1 = 1-12, 2 = 13-24, 3 = 25-36): ", 1, 3);
+                break;
+            case RouletteBetType::BET_COLUMN:
+                number = ui.askInput("Enter the column (1-3): ", 1, 3);
+                break;
+            default:
+                return;
+        }
+
+        if (RouletteRules::coverage(type, number, second) != 0) {
+            return;
+        }
+
+        ui.print("Those numbers do not form a valid " +
+                 TextRes::ROULETTE_BET_TYPES[static_cast<int>(type)] + " bet, try again.");
     }
+}
 
-    spunTile = resultIndex;
+int RouletteGame::askBetAmount(int available) {
+    int choice = ui.askChoice(TextRes::BET_SELECT_TITLE,
+                              TextRes::BET_SELECT_OPTIONS);
+
+    switch (static_cast<BetOptions>(choice)) {
+        case BetOptions::BET_ALL_IN:
+            return available;
+        case BetOptions::BET_HALF:
+            return available / 2;
+        case BetOptions::BET_QUARTER:
+            return available / 4;
+        case BetOptions::BET_CUSTOM:
+            return ui.askInput(
+                "Enter your bet amount (1 - " + std::to_string(available) + "): ",
+                1,
+                available
+            );
+        default:
+            ui.print("Invalid choice! Please select a valid bet amount.");
+            return 0;
+    }
 }
 
 int RouletteGame::askForBet(Player& player) {
     RoundUI::clear();
+    slip.clear();
+    lastPayouts.clear();
 
     int maxBalance = player.getBalance();
 
@@ -129,98 +158,90 @@ int RouletteGame::askForBet(Player& player) {
         return -1;
     }
 
-    int choice = ui.askChoice(TextRes::ROULETTE_BET_OPTIONS_TITLE, TextRes::ROULETTE_BET_TYPES);
+    while (slip.getTotalStake() < maxBalance) {
+        int available = maxBalance - slip.getTotalStake();
 
-    RouletteBetType newBetType = static_cast<RouletteBetType>(choice);
+        RoundUI::clear();
+        std::vector<std::string> info;
+        info.emplace_back("Available to bet: " + std::to_string(available) + "$");
+        addSlipInfo(info);
+        ui.drawBox("", info);
 
-    if (newBetType == RouletteBetType::BET_NUMBER) {
-        int input = ui.askInput("Enter the number you want to bet on (0-36): ",
-                                0, 36);
-        betNumber = input;
-    }
+        std::vector<std::string> options = TextRes::ROULETTE_BET_TYPES;
+        if (!slip.empty()) {
+            options.emplace_back(TextRes::ROULETTE_BET_SLIP_DONE);
+        }
 
-    choice = ui.askChoice(TextRes::BET_SELECT_TITLE,
-                          TextRes::BET_SELECT_OPTIONS);
+        int choice = ui.askChoice(TextRes::ROULETTE_BET_OPTIONS_TITLE, options, false);
+        if (choice >= static_cast<int>(TextRes::ROULETTE_BET_TYPES.size())) {
+            break;
+        }
 
-    int newBetAmount = 0;
+        auto type = static_cast<RouletteBetType>(choice);
+        int number = -1;
+        int second = -1;
+        askBetNumbers(type, number, second);
 
-    switch (static_cast<BetOptions>(choice)) {
-        case BetOptions::BET_ALL_IN:
-            newBetAmount = maxBalance;
-            break;
-        case BetOptions::BET_HALF:
-            newBetAmount = maxBalance / 2;
-            break;
-        case BetOptions::BET_QUARTER:
-            newBetAmount = maxBalance / 4;
-            break;
-        case BetOptions::BET_CUSTOM: {
-            newBetAmount = ui.askInput(
-                "Enter your bet amount (1 - " + std::to_string(maxBalance) + "): ",
-                1,
-                maxBalance
-            );
-            break;
+        int amount = askBetAmount(available);
+        if (amount <= 0 || amount > available) {
+            ui.print("Insufficient balance for this bet (" + std::to_string(amount) + "$)!");
+            ui.waitForEnter();
+            continue;
         }
-        default:
-            ui.print("Invalid choice! Please select a valid bet amount.");
-            return askForBet(player);
-    }
 
-    if (newBetAmount <= 0 || !player.canAffordBet(newBetAmount)) {
-        ui.print("Insufficient balance for this bet (" + std::to_string(newBetAmount) + "$)!");
-        ui.waitForEnter();
-        return askForBet(player);
+        try {
+            slip.add(type, number, amount, second);
+        } catch (const std::invalid_argument& e) {
+            ui.print("Bet error: " + std::string(e.what()));
+            ui.waitForEnter();
+        }
     }
 
-    betType = newBetType;
-    return newBetAmount;
+    return slip.getTotalStake();
 }
 
-double RouletteGame::calculateMultiplier(int selectedTile) {
-    if (selectedTile < 0 || selectedTile >= static_cast<int>(wheel.size())) {
-        return 0.0;
+std::string RouletteGame::describeBet(size_t index) const {
+    const RouletteBetSpec& spec = slip.getSpecs()[index];
+    const RouletteBet& bet = slip.getBets()[index];
+
+    std::string line = TextRes::ROULETTE_BET_TYPES[static_cast<int>(spec.type)];
+
+    if (spec.type == RouletteBetType::BET_DOZEN || spec.type == RouletteBetType::BET_COLUMN) {
+        line += " #" + std::to_string(spec.number);
+    } else if (spec.type >= RouletteBetType::BET_SPLIT || spec.type == RouletteBetType::BET_NUMBER) {
+        std::string numbers;
+        for (int n = 0; n < RouletteRules::NUMBER_COUNT; ++n) {
+            if (RouletteRules::covers(bet.coverage, n)) {
+                numbers += (numbers.empty() ? "" : "/") + std::to_string(n);
+            }
+        }
+        line += " [" + numbers + "]";
     }
 
-    const RouletteTile& tile = wheel[selectedTile];
-    bool win = false;
+    return line + " - " + std::to_string(bet.amount) + "$";
+}
 
-    switch (betType) {
-        case RouletteBetType::BET_RED:
-            win = (tile.color == RouletteTileType::RED);
-            break;
-        case RouletteBetType::BET_BLACK:
-            win = (tile.color == RouletteTileType::BLACK);
-            break;
-        case RouletteBetType::BET_GREEN:
-            win = (tile.color == RouletteTileType::GREEN);
-            break;
-        case RouletteBetType::BET_NUMBER:
-            win = (tile.number == betNumber);
-            break;
-        case RouletteBetType::BET_ODD:
-            win = (tile.number != 0 && tile.number % 2 == 1);
-            break;
-        case RouletteBetType::BET_EVEN:
-            win = (tile.number != 0 && tile.number % 2 == 0);
-            break;
-        case RouletteBetType::BET_LOW:
-            win = (tile.number >= 1 && tile.number <= 18);
-            break;
-        case RouletteBetType::BET_HIGH:
-            win = (tile.number >= 19 && tile.number <= 36);
-            break;
-        default:
-            return 0.0;
+void RouletteGame::addSlipInfo(std::vector<std::string>& info) const {
+    constexpr size_t MAX_LISTED_BETS = 6;
+
+    if (slip.empty()) {
+        return;
     }
 
-    if (!win) {
-        return 0.0;
+    info.emplace_back("Bets: " + std::to_string(slip.size()) +
+                      ", total " + std::to_string(slip.getTotalStake()) + "$");
+
+    for (size_t i = 0; i < slip.size() && i < MAX_LISTED_BETS; ++i) {
+        std::string line = "  " + describeBet(i);
+        if (i < lastPayouts.size()) {
+            line += lastPayouts[i] > 0 ? "  WON " + std::to_string(lastPayouts[i]) + "$" : "  lost";
+        }
+        info.emplace_back(std::move(line));
     }
 
-    return static_cast<double>(
-        ROULETTE_PAYOUT_MULTIPLIERS[static_cast<int>(betType)]
-    );
+    if (slip.size() > MAX_LISTED_BETS) {
+        info.emplace_back("  ... and " + std::to_string(slip.size() - MAX_LISTED_BETS) + " more");
+    }
 }
 
 void RouletteGame::displayPayouts() const {
@@ -231,7 +252,7 @@ void RouletteGame::displayPayouts() const {
 
     for (std::size_t i = 0; i < TextRes::ROULETTE_BET_TYPES.size(); ++i) {
         const std::string& type = TextRes::ROULETTE_BET_TYPES[i];
-        int multiplier = ROULETTE_PAYOUT_MULTIPLIERS[i];
+        int multiplier = RouletteRules::PAYOUT_MULTIPLIERS[i];
 
         std::string line = type + " ->  x" + std::to_string(multiplier);
         payoutInfo.emplace_back(std::move(line));
@@ -248,13 +269,7 @@ int RouletteGame::renderInterface(const Player &player) {
 
     std::vector<std::string> info;
     info.emplace_back(player.getName() + "'s Balance: " + std::to_string(player.getBalance()));
-    if (player.hasActiveBet()) {
-        info.emplace_back("Current bet: " + std::to_string(player.getCurrentBet()) +
-                         "$ - " + TextRes::ROULETTE_BET_TYPES[static_cast<int>(betType)] +
-                         (betType == RouletteBetType::BET_NUMBER
-                              ? " (" + std::to_string(betNumber) + ")"
-                              : ""));
-    }
+    addSlipInfo(info);
 
     if (lastScore >= 0) {
         if (lastScore > 0) {
@@ -291,7 +306,6 @@ GameState RouletteGame::playRound(Player &player) {
         return GameState::GAME_MENU;
     }
 
-    int selectedBet = bet;
     GameState newState = GameState::GAME_MENU;
     exit = false;
 
@@ -302,21 +316,19 @@ GameState RouletteGame::playRound(Player &player) {
             case RouletteOptions::SPIN: {
                 try {
                     if (!player.hasActiveBet()) {
-                        player.placeBet(selectedBet);
+                        player.placeBet(slip.getTotalStake());
                     }
 
-                    int resultIndex = spinWheel();
-                    animateSpin(player, resultIndex);
+                    lastPayouts.clear();
+                    const RoundOutcome outcome = engine.resolveRound(BetSlip::roulette(slip), random);
+                    animateSpin(player, engine.getWheelIndex());
 
-                    double multiplier = calculateMultiplier(resultIndex);
+                    const std::span<const int> payouts = engine.getPayouts();
+                    lastPayouts.assign(payouts.begin(), payouts.end());
+                    int payout = static_cast<int>(outcome.paid);
 
-                    if (multiplier > 0.0) {
-                        player.winBet(multiplier);
-                        lastScore = static_cast<int>(selectedBet);
-                    } else {
-                        player.loseBet();
-                        lastScore = 0;
-                    }
+                    player.settleBet(payout);
+                    lastScore = payout;
                 } catch (const std::invalid_argument& e) {
                     errorMessage = "Bet error: " + std::string(e.what());
                     lastScore = -1;
@@ -326,7 +338,7 @@ GameState RouletteGame::playRound(Player &player) {
                 }
 
 
-                if (player.getBalance() < bet) {
+                if (player.getBalance() < slip.getTotalStake()) {
                     errorMessage = "Insufficient balance to place the bet.";
                     break;
                 }
@@ -348,7 +360,6 @@ GameState RouletteGame::playRound(Player &player) {
                 if (newBet <= 0) {
                     errorMessage = "Bet selection cancelled!";
                 } else {
-                    selectedBet = newBet;
                     lastScore = -1;
                 }
                 break;
@@ -12,38 +12,30 @@
 #ifndef KASYNO_ROULETTEGAME_H
 #define KASYNO_ROULETTEGAME_H
 #include "Game.h"
-#include "RouletteTypes.h"
-
-/**
- * @enum RouletteBetType
- * @brief Types of bets available in roulette
- */
-enum class RouletteBetType {
-    BET_RED = 0,     ///< Bet on red numbers
-    BET_BLACK,       ///< Bet on black numbers
-    BET_GREEN,       ///< Bet on green (0)
-    BET_NUMBER,      ///< Bet on specific number
-    BET_ODD,         ///< Bet on odd numbers
-    BET_EVEN,        ///< Bet on even numbers
-    BET_LOW,         ///< Bet on low numbers (1-18)
-    BET_HIGH,        ///< Bet on high numbers (19-36)
-};
+#include "RouletteBetSlip.h"
+#include "RouletteEngine.h"
 
 /**
  * @class RouletteGame
  * @brief Implementation of European Roulette with 37 numbers (0-36)
  *
  * Features:
- * - Multiple bet types (color, number, odd/even, high/low)
+ * - Inside and outside bets (numbers, splits, streets, corners, six lines,
+ *   colors, odd/even, high/low, dozens, columns)
+ * - Any number of bets per spin, settled together
  * - Animated wheel spin with progressive slowdown
  * - Different payouts for different bet types
  * - Visual wheel representation
+ *
+ * Spins are resolved by RouletteEngine; the game only adds input,
+ * animation and rendering.
  */
 class RouletteGame: public Game {
 private:
     int lastScore;                ///< Last round's score
-    RouletteBetType betType;      ///< Current bet type
-    int betNumber;                ///< Bet number (if betting on specific number)
+    RouletteBetSlip slip;         ///< Bets placed on the next spin
+    RouletteEngine engine;                ///< Rules engine resolving the spins
+    std::vector<int> lastPayouts; ///< Payout of each bet in the last spin
     std::vector<RouletteTile> wheel;      ///< Roulette wheel tiles
     std::vector<RouletteTile> prevTiles;  ///< Previous tiles for animation
     int spunTile;                         ///< Result tile index
@@ -63,11 +55,32 @@ private:
     int renderInterface(const Player& player) override;
 
     /**
-     * @brief Calculates win multiplier based on bet type and result
-     * @param selectedTile Index of the result tile
-     * @return double Win multiplier (0.0 if lost)
+     * @brief Asks for the numbers a bet covers, until they form a valid bet
+     * @param type Bet type
+     * @param number Output, chosen number (see RouletteRules::coverage)
+     * @param second Output, second number of a split
+     */
+    void askBetNumbers(RouletteBetType type, int& number, int& second);
+
+    /**
+     * @brief Asks for the amount of one bet
+     * @param available Money not yet staked on the slip
+     * @return int Bet amount (0 if invalid)
      */
-    double calculateMultiplier(int selectedTile);
+    int askBetAmount(int available);
+
+    /**
+     * @brief Describes one bet of the slip
+     * @param index Bet index
+     * @return std::string Bet name, numbers and amount
+     */
+    std::string describeBet(size_t index) const;
+
+    /**
+     * @brief Adds the bets of the slip to an info box
+     * @param info Lines of the box
+     */
+    void addSlipInfo(std::vector<std::string>& info) const;
 
     /**
      * @brief Displays roulette payout table
@@ -94,11 +107,6 @@ private:
      */
     RouletteTileType getColorForNumber(int number) const;
 
-    /**
-     * @brief Spins the wheel and returns result index
-     * @return int Index of the result tile
-     */
-    int spinWheel();
 public:
     /**
      * @brief Constructor
@@ -0,0 +1,76 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "RouletteRules.h"
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+RouletteBet RouletteRules::makeBet(RouletteBetType type, int number, int amount, int second) {
+    if (amount <= 0) {
+        throw std::invalid_argument(
+            "RouletteRules::makeBet: amount (" + std::to_string(amount) + ") must be positive"
+        );
+    }
+
+    if (static_cast<int64_t>(amount) * payout(type) > std::numeric_limits<int>::max()) {
+        throw std::invalid_argument(
+            "RouletteRules::makeBet: amount (" + std::to_string(amount) + ") is too large"
+        );
+    }
+
+    const uint64_t mask = coverage(type, number, second);
+    if (mask == 0) {
+        throw std::invalid_argument(
+            "RouletteRules::makeBet: bet covers no number (number " + std::to_string(number) + ")"
+        );
+    }
+
+    return RouletteBet{mask, amount, amount * payout(type)};
+}
+
+int RouletteRules::spin(Rng& rng) {
+    return static_cast<int>(rng.randBelow(NUMBER_COUNT));
+}
+
+int64_t RouletteRules::settle(std::span<const RouletteBet> bets, int number, std::span<int> payouts) {
+    if (payouts.size() < bets.size()) {
+        throw std::invalid_argument(
+            "RouletteRules::settle: payouts buffer (" + std::to_string(payouts.size()) +
+            ") is smaller than bets (" + std::to_string(bets.size()) + ")"
+        );
+    }
+
+    if (number < 0 || number >= NUMBER_COUNT) {
+        throw std::invalid_argument(
+            "RouletteRules::settle: number (" + std::to_string(number) + ") must be between 0 and 36"
+        );
+    }
+
+    int64_t total = 0;
+    for (size_t i = 0; i < bets.size(); ++i) {
+        // All ones if the number is covered, zero otherwise.
+        const int keep = -static_cast<int>((bets[i].coverage >> number) & 1ULL);
+        payouts[i] = bets[i].win & keep;
+        total += payouts[i];
+    }
+
+    return total;
+}
+
+int64_t RouletteRules::totalPayout(std::span<const RouletteBet> bets, int number) {
+    if (number < 0 || number >= NUMBER_COUNT) {
+        throw std::invalid_argument(
+            "RouletteRules::totalPayout: number (" + std::to_string(number) + ") must be between 0 and 36"
+        );
+    }
+
+    int64_t total = 0;
+    for (const RouletteBet& bet : bets) {
+        total += bet.win & -static_cast<int>((bet.coverage >> number) & 1ULL);
+    }
+
+    return total;
+}
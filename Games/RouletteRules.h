@@ -0,0 +1,254 @@
+/**
+ * @file RouletteRules.h
+ * @brief Roulette bet coverage masks, payouts and batch settlement
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_ROULETTERULES_H
+#define KASYNO_ROULETTERULES_H
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <span>
+
+#include "RouletteTypes.h"
+#include "../Rng.h"
+
+/**
+ * @struct RouletteBet
+ * @brief A bet resolved to its coverage mask
+ *
+ * Bit n of coverage is set if the bet wins when n comes up,
+ * so settling a bet is a single shift and AND.
+ */
+struct RouletteBet {
+    uint64_t coverage = 0;  ///< Winning numbers (bit n = number n)
+    int amount = 0;         ///< Money staked
+    int win = 0;            ///< Money paid back on a win (amount * multiplier)
+};
+
+/**
+ * @brief Builds a mask from a list of roulette numbers
+ * @param numbers Numbers to set
+ * @return uint64_t Mask (bit n = number n)
+ */
+template <size_t N>
+constexpr uint64_t rouletteMask(const std::array<int, N>& numbers) {
+    uint64_t mask = 0;
+    for (int number : numbers) mask |= 1ULL << number;
+    return mask;
+}
+
+/**
+ * @brief Builds a mask of every step-th roulette number in a range
+ * @param first First number
+ * @param last Last number (inclusive)
+ * @param step Distance between numbers
+ * @return uint64_t Mask (bit n = number n)
+ */
+constexpr uint64_t rouletteRangeMask(int first, int last, int step = 1) {
+    uint64_t mask = 0;
+    for (int number = first; number <= last; number += step) mask |= 1ULL << number;
+    return mask;
+}
+
+/**
+ * @class RouletteRules
+ * @brief Numbers, colors, bet coverage and payouts of European roulette
+ *
+ * Contains no UI state, so it can be used both by RouletteGame
+ * and by headless tools. Every bet is a 37-bit mask over the numbers.
+ */
+class RouletteRules {
+public:
+    static constexpr int NUMBER_COUNT = 37;  ///< Numbers on the wheel (0-36)
+    static constexpr int BET_TYPE_COUNT = 14; ///< Number of RouletteBetType values
+
+    static constexpr uint64_t ALL_MASK = (1ULL << NUMBER_COUNT) - 1;     ///< Every number
+    static constexpr uint64_t GREEN_MASK = 1ULL;                          ///< Zero
+    static constexpr uint64_t RED_MASK = rouletteMask(std::array<int, 18>{
+        1, 3, 5, 7, 9, 12, 14, 16, 18,
+        19, 21, 23, 25, 27, 30, 32, 34, 36
+    });                                                                   ///< Red numbers
+    static constexpr uint64_t BLACK_MASK = ALL_MASK & ~RED_MASK & ~GREEN_MASK;  ///< Black numbers
+    static constexpr uint64_t ODD_MASK = rouletteRangeMask(1, 35, 2);         ///< Odd numbers
+    static constexpr uint64_t EVEN_MASK = rouletteRangeMask(2, 36, 2);        ///< Even numbers (zero excluded)
+    static constexpr uint64_t LOW_MASK = rouletteRangeMask(1, 18);            ///< 1-18
+    static constexpr uint64_t HIGH_MASK = rouletteRangeMask(19, 36);          ///< 19-36
+
+    /// @brief Payout multipliers for each bet type (stake included)
+    static constexpr std::array<int, BET_TYPE_COUNT> PAYOUT_MULTIPLIERS = {
+        2,  // RED
+        2,  // BLACK
+        35, // GREEN
+        35, // NUMBER
+        2,  // ODD
+        2,  // EVEN
+        2,  // LOW
+        2,  // HIGH
+        18, // SPLIT
+        12, // STREET
+        9,  // CORNER
+        6,  // SIX_LINE
+        3,  // DOZEN
+        3   // COLUMN
+    };
+
+    /// @brief Numbers in wheel order, starting from zero
+    static constexpr std::array<int, NUMBER_COUNT> WHEEL_ORDER = {
+        0, 32, 15, 19, 4, 21, 2, 25,
+        17, 34, 6, 27, 13, 36, 11, 30,
+        8, 23, 10, 5, 24, 16, 33, 1,
+        20, 14, 31, 9, 22, 18, 29, 7,
+        28, 12, 35, 3, 26
+    };
+
+    /**
+     * @brief Gets the color of a number
+     * @param number Number on the wheel (0-36)
+     * @return RouletteTileType Color of the number
+     */
+    static constexpr RouletteTileType colorOf(int number) {
+        const uint64_t bit = 1ULL << number;
+        return (bit & GREEN_MASK) ? RouletteTileType::GREEN :
+               (bit & RED_MASK) ? RouletteTileType::RED : RouletteTileType::BLACK;
+    }
+
+    /**
+     * @brief Gets the numbers covered by a split
+     * @param first One number of the split
+     * @param second The other number, next to first on the layout
+     * @return uint64_t Coverage mask (0 if the numbers are not adjacent)
+     */
+    static constexpr uint64_t splitCoverage(int first, int second) {
+        const int low = first < second ? first : second;
+        const int high = first < second ? second : first;
+        if (low < 0 || high >= NUMBER_COUNT) return 0;
+
+        const bool zeroSplit = low == 0 && high >= 1 && high <= 3;
+        const bool sideBySide = low > 0 && high == low + 1 && low % 3 != 0;
+        const bool aboveBelow = low > 0 && high == low + 3;
+        return (zeroSplit || sideBySide || aboveBelow) ? (1ULL << low) | (1ULL << high) : 0;
+    }
+
+    /**
+     * @brief Gets the numbers covered by a bet
+     *
+     * The meaning of number depends on the bet type:
+     * - BET_NUMBER: the number (0-36)
+     * - BET_SPLIT: one number of the pair, second is the other one
+     * - BET_STREET: any number of the row (1-36)
+     * - BET_CORNER: lowest number of the corner (1-32, not in the right column)
+     * - BET_SIX_LINE: any number of the first row (1-33)
+     * - BET_DOZEN, BET_COLUMN: which one (1-3)
+     * Other bet types ignore it.
+     *
+     * @param type Bet type
+     * @param number Chosen number (see above)
+     * @param second Second number (BET_SPLIT only)
+     * @return uint64_t Coverage mask (0 for an invalid bet)
+     */
+    static constexpr uint64_t coverage(RouletteBetType type, int number = -1, int second = -1) {
+        const int row = (number - 1) / 3;  // 0-11 for numbers 1-36
+
+        switch (type) {
+            case RouletteBetType::BET_RED:    return RED_MASK;
+            case RouletteBetType::BET_BLACK:  return BLACK_MASK;
+            case RouletteBetType::BET_GREEN:  return GREEN_MASK;
+            case RouletteBetType::BET_NUMBER:
+                return (number >= 0 && number < NUMBER_COUNT) ? 1ULL << number : 0;
+            case RouletteBetType::BET_ODD:    return ODD_MASK;
+            case RouletteBetType::BET_EVEN:   return EVEN_MASK;
+            case RouletteBetType::BET_LOW:    return LOW_MASK;
+            case RouletteBetType::BET_HIGH:   return HIGH_MASK;
+            case RouletteBetType::BET_SPLIT:  return splitCoverage(number, second);
+            case RouletteBetType::BET_STREET:
+                return (number >= 1 && number <= 36) ? 0b111ULL << (row * 3 + 1) : 0;
+            case RouletteBetType::BET_CORNER:
+                return (number >= 1 && number <= 32 && number % 3 != 0) ? 0b11011ULL << number : 0;
+            case RouletteBetType::BET_SIX_LINE:
+                return (number >= 1 && number <= 33) ? 0b111111ULL << (row * 3 + 1) : 0;
+            case RouletteBetType::BET_DOZEN:
+                return (number >= 1 && number <= 3) ? rouletteRangeMask(number * 12 - 11, number * 12) : 0;
+            case RouletteBetType::BET_COLUMN:
+                return (number >= 1 && number <= 3) ? rouletteRangeMask(number, 36, 3) : 0;
+            default:                          return 0;
+        }
+    }
+
+    /**
+     * @brief Gets the payout multiplier of a bet type
+     * @param type Bet type
+     * @return int Multiplier (stake included)
+     */
+    static constexpr int payout(RouletteBetType type) {
+        return PAYOUT_MULTIPLIERS[static_cast<int>(type)];
+    }
+
+    /**
+     * @brief Checks if a coverage mask wins on a number
+     * @param coverage Coverage mask
+     * @param number Winning number (0-36)
+     * @return bool True if the number is covered
+     */
+    static constexpr bool covers(uint64_t coverage, int number) {
+        return (coverage >> number) & 1ULL;
+    }
+
+    /**
+     * @brief Resolves a bet to its coverage mask and winning amount
+     * @param type Bet type
+     * @param number Chosen number (see coverage())
+     * @param amount Money staked
+     * @param second Second number (BET_SPLIT only)
+     * @return RouletteBet Resolved bet
+     * @throws std::invalid_argument if amount is not positive or too large, or the bet covers no number
+     */
+    static RouletteBet makeBet(RouletteBetType type, int number, int amount, int second = -1);
+
+    /**
+     * @brief Spins the wheel
+     * @param rng Random number generator
+     * @return int Winning number (0-36)
+     */
+    static int spin(Rng& rng);
+
+    /**
+     * @brief Settles many bets against one spin in a single branch-free pass
+     * @param bets Bets to settle
+     * @param number Winning number (0-36)
+     * @param payouts Output, money paid back for each bet (same size as bets)
+     * @return int64_t Total money paid back
+     * @throws std::invalid_argument if payouts is smaller than bets or number is out of range
+     */
+    static int64_t settle(std::span<const RouletteBet> bets, int number, std::span<int> payouts);
+
+    /**
+     * @brief Totals the money paid back to many bets against one spin
+     * @param bets Bets to settle
+     * @param number Winning number (0-36)
+     * @return int64_t Total money paid back
+     */
+    static int64_t totalPayout(std::span<const RouletteBet> bets, int number);
+};
+
+static_assert(std::popcount(RouletteRules::RED_MASK) == 18, "18 red numbers");
+static_assert(std::popcount(RouletteRules::BLACK_MASK) == 18, "18 black numbers");
+static_assert((RouletteRules::ODD_MASK | RouletteRules::EVEN_MASK | RouletteRules::GREEN_MASK) == RouletteRules::ALL_MASK,
+              "odd, even and zero cover the wheel");
+static_assert(RouletteRules::coverage(RouletteBetType::BET_CORNER, 1) == rouletteMask(std::array<int, 4>{1, 2, 4, 5}),
+              "corner 1 covers 1, 2, 4 and 5");
+static_assert(std::popcount(RouletteRules::coverage(RouletteBetType::BET_SIX_LINE, 33)) == 6, "last six line");
+static_assert((RouletteRules::coverage(RouletteBetType::BET_COLUMN, 1) | RouletteRules::coverage(RouletteBetType::BET_COLUMN, 2) |
+               RouletteRules::coverage(RouletteBetType::BET_COLUMN, 3) | RouletteRules::GREEN_MASK) == RouletteRules::ALL_MASK,
+              "columns and zero cover the wheel");
+static_assert(std::popcount(RouletteRules::splitCoverage(0, 2)) == 2, "zero splits with 1, 2 and 3");
+static_assert(RouletteRules::splitCoverage(0, 0) == 0, "a number cannot be split with itself");
+
+#endif //KASYNO_ROULETTERULES_H
@@ -33,4 +33,25 @@ struct RouletteTile {
     int number;              ///< Number on the tile (0-36)
 };
 
+/**
+ * @enum RouletteBetType
+ * @brief Types of bets available in roulette
+ */
+enum class RouletteBetType {
+    BET_RED = 0,     ///< Bet on red numbers
+    BET_BLACK,       ///< Bet on black numbers
+    BET_GREEN,       ///< Bet on green (0)
+    BET_NUMBER,      ///< Bet on specific number
+    BET_ODD,         ///< Bet on odd numbers
+    BET_EVEN,        ///< Bet on even numbers
+    BET_LOW,         ///< Bet on low numbers (1-18)
+    BET_HIGH,        ///< Bet on high numbers (19-36)
+    BET_SPLIT,       ///< Bet on two adjacent numbers
+    BET_STREET,      ///< Bet on a row of three numbers
+    BET_CORNER,      ///< Bet on four numbers meeting at a corner
+    BET_SIX_LINE,    ///< Bet on two adjacent rows (six numbers)
+    BET_DOZEN,       ///< Bet on 1-12, 13-24 or 25-36
+    BET_COLUMN,      ///< Bet on one of the three columns
+};
+
 #endif //KASYNO_ROULETTETYPES_H
\ No newline at end of file
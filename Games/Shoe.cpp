@@ -0,0 +1,44 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "Shoe.h"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+Shoe::Shoe(int decks, double penetration): decks(decks) {
+    if (decks < MIN_DECKS || decks > MAX_DECKS) {
+        throw std::invalid_argument(
+            "Shoe::Shoe: deck count (" + std::to_string(decks) + ") must be between " +
+            std::to_string(MIN_DECKS) + " and " + std::to_string(MAX_DECKS)
+        );
+    }
+
+    if (!(penetration > 0.0 && penetration <= 1.0)) {
+        throw std::invalid_argument(
+            "Shoe::Shoe: penetration (" + std::to_string(penetration) + ") must be in range (0.0, 1.0]"
+        );
+    }
+
+    cards.reserve(static_cast<size_t>(decks) * Card::DECK_SIZE);
+    for (int deck = 0; deck < decks; ++deck) {
+        for (int suit = 0; suit < Card::SUIT_COUNT; ++suit) {
+            for (int rank = 0; rank < Card::RANK_COUNT; ++rank) {
+                cards.push_back(Card::make(rank, static_cast<Suit>(suit)));
+            }
+        }
+    }
+
+    cutCard = static_cast<size_t>(static_cast<double>(cards.size()) * penetration);
+    next = cards.size();  // Not shuffled yet, must be shuffled before dealing
+}
+
+void Shoe::shuffle(Rng& rng) {
+    for (size_t i = cards.size() - 1; i > 0; --i) {
+        const size_t j = rng.randBelow(static_cast<uint32_t>(i + 1));
+        std::swap(cards[i], cards[j]);
+    }
+    next = 0;
+}
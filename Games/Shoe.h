@@ -0,0 +1,98 @@
+/**
+ * @file Shoe.h
+ * @brief Flat multi-deck card shoe with a cut card
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_SHOE_H
+#define KASYNO_SHOE_H
+
+#include <span>
+#include <vector>
+
+#include "Card.h"
+#include "../Rng.h"
+
+/**
+ * @class Shoe
+ * @brief Contiguous shoe of 1-8 decks
+ *
+ * Cards are stored in one byte array. Shuffling is a single in-place
+ * Fisher-Yates pass and drawing only advances an index. The cut card
+ * marks how deep the shoe is dealt before it should be reshuffled.
+ */
+class Shoe {
+    std::vector<Card> cards;   ///< All cards of the shoe in dealing order
+    size_t next = 0;           ///< Index of the next card to deal
+    size_t cutCard = 0;        ///< Index of the cut card
+    int decks;                 ///< Number of decks in the shoe
+public:
+    static constexpr int MIN_DECKS = 1;  ///< Minimum number of decks
+    static constexpr int MAX_DECKS = 8;  ///< Maximum number of decks
+
+    /**
+     * @brief Constructor - creates an ordered shoe
+     * @param decks Number of decks (1-8)
+     * @param penetration Fraction of the shoe dealt before the cut card (0.0-1.0]
+     * @throws std::invalid_argument if decks or penetration are out of range
+     */
+    explicit Shoe(int decks = 6, double penetration = 0.75);
+
+    /**
+     * @brief Collects all cards and shuffles the whole shoe
+     * @param rng Random number generator
+     */
+    void shuffle(Rng& rng);
+
+    /**
+     * @brief Deals the next card
+     * @return Card Dealt card
+     * @note Caller must check empty() first
+     */
+    Card draw() { return cards[next++]; }
+
+    /**
+     * @brief Checks if the cut card has been reached
+     * @return bool True if the shoe should be reshuffled before the next round
+     */
+    bool needsShuffle() const { return next >= cutCard; }
+
+    /**
+     * @brief Checks if all cards have been dealt
+     * @return bool True if no cards remain
+     */
+    bool empty() const { return next >= cards.size(); }
+
+    /**
+     * @brief Gets the number of cards left to deal
+     * @return size_t Remaining cards
+     */
+    size_t remaining() const { return cards.size() - next; }
+
+    /**
+     * @brief Gets the cards left to deal
+     * @return std::span<const Card> Undealt cards
+     */
+    std::span<const Card> remainingCards() const {
+        return std::span<const Card>(cards).subspan(next);
+    }
+
+    /**
+     * @brief Gets the number of decks
+     * @return int Deck count
+     */
+    int deckCount() const { return decks; }
+
+    /**
+     * @brief Gets the total number of cards
+     * @return size_t Shoe size
+     */
+    size_t size() const { return cards.size(); }
+};
+
+#endif //KASYNO_SHOE_H
@@ -0,0 +1,33 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "SlotsEngine.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+/// @brief Highest multiplier of the paytable (triples always pay more than pairs)
+static constexpr int MAX_MULTIPLIER = std::ranges::max(SlotsRules::TRIPLET_PAYOUTS);
+
+RoundOutcome SlotsEngine::resolveRound(const BetSlip& slip, Rng& rng) {
+    if (slip.stake <= 0) {
+        throw std::invalid_argument(
+            "SlotsEngine::resolveRound: stake (" + std::to_string(slip.stake) + ") must be positive"
+        );
+    }
+
+    reels = SlotsRules::spin(rng);
+    outcome = SlotsRules::evaluate(reels);
+
+    RoundOutcome result;
+    result.staked = slip.stake;
+    result.paid = static_cast<int64_t>(slip.stake) * outcome.multiplier;
+    result.result = outcome.symbol;
+    return result;
+}
+
+int64_t SlotsEngine::maxPayout(const BetSlip& slip) const {
+    return static_cast<int64_t>(slip.stake) * MAX_MULTIPLIER;
+}
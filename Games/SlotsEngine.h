@@ -0,0 +1,55 @@
+/**
+ * @file SlotsEngine.h
+ * @brief Slot machine rounds without UI
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_SLOTSENGINE_H
+#define KASYNO_SLOTSENGINE_H
+
+#include "GameEngine.h"
+#include "SlotsRules.h"
+
+/**
+ * @class SlotsEngine
+ * @brief Spins the reels and pays by SlotsRules
+ */
+class SlotsEngine: public GameEngine {
+    SlotsRules::Reels reels = {-1, -1, -1};                 ///< Reels of the last round
+    SlotsOutcome outcome{SlotsOutcomeKind::NONE, -1, 0};    ///< Combination of the last round
+public:
+    /**
+     * @brief Spins the reels and pays stake * multiplier
+     * @param slip Slip with the stake
+     * @param rng Random number generator
+     * @return RoundOutcome Money result (result = matched symbol, -1 if none)
+     * @throws std::invalid_argument if the stake is not positive
+     */
+    RoundOutcome resolveRound(const BetSlip& slip, Rng& rng) override;
+
+    /**
+     * @brief Gets the payout of the best triple
+     * @param slip Slip with the stake
+     * @return int64_t stake * highest multiplier
+     */
+    int64_t maxPayout(const BetSlip& slip) const override;
+
+    /**
+     * @brief Gets the reels of the last round
+     * @return const SlotsRules::Reels& Symbol indices ({-1, -1, -1} before the first round)
+     */
+    const SlotsRules::Reels& getReels() const { return reels; }
+
+    /**
+     * @brief Gets the combination of the last round
+     * @return const SlotsOutcome& Matched combination and multiplier
+     */
+    const SlotsOutcome& getOutcome() const { return outcome; }
+};
+
+#endif //KASYNO_SLOTSENGINE_H
@@ -4,10 +4,21 @@
 
 #include "SlotsGame.h"
 
+#include <chrono>
 #include <stdexcept>
 
+#include "../AnimationTimeline.h"
 #include "../ExitHelper.h"
 
+/**
+ * @brief Gets the slot symbols with their display widths, measured once
+ * @return const std::vector<MeasuredText>& Symbols in TextRes::SLOT_SYMBOLS order
+ */
+static const std::vector<MeasuredText>& measuredSymbols() {
+    static const std::vector<MeasuredText> symbols(TextRes::SLOT_SYMBOLS.begin(), TextRes::SLOT_SYMBOLS.end());
+    return symbols;
+}
+
 SlotsGame::SlotsGame(Rng &rng): Game("Slots", rng) {};
 
 SlotsGame::~SlotsGame() = default;
@@ -67,15 +78,12 @@ int SlotsGame::askForBet(Player& player) {
 int SlotsGame::renderInterface(const Player& player) {
     RoundUI::clear();
 
-    std::vector<std::string> slotSymbols;
+    std::vector<MeasuredText> slotSymbols;
     if (slots[0] == -1) {
-        slotSymbols = { "?", "?", "?" };
+        slotSymbols.assign(3, MeasuredText("?"));
     } else {
-        slotSymbols = {
-            TextRes::SLOT_SYMBOLS[slots[0]],
-            TextRes::SLOT_SYMBOLS[slots[1]],
-            TextRes::SLOT_SYMBOLS[slots[2]]
-        };
+        const auto& symbols = measuredSymbols();
+        slotSymbols = { symbols[slots[0]], symbols[slots[1]], symbols[slots[2]] };
     }
 
     ui.renderSlots(slotSymbols);
@@ -109,30 +117,6 @@ int SlotsGame::renderInterface(const Player& player) {
     return option;
 }
 
-std::array<int, 3> SlotsGame::spinSlots() {
-    auto getSymbol = [this]() {
-        int chance = random.randInt(1, 100);
-        return (chance <= 40) ? 0 : (chance <= 70) ? 1 : (chance <= 85) ? 2 :
-               (chance <= 95) ? 3 : (chance <= 99) ? 4 : 5;
-    };
-
-    return {getSymbol(), getSymbol(), getSymbol()};
-}
-
-double SlotsGame::calculateMultiplier(const std::array<int, 3>& slots) {
-    if (slots[0] == slots[1] && slots[1] == slots[2]) {
-        return static_cast<double>(tripletPayouts[slots[0]]);
-    }
-
-    if (slots[0] == slots[1] || slots[1] == slots[2] || slots[0] == slots[2]) {
-        int pairSymbol = (slots[0] == slots[1]) ? slots[0] :
-                         (slots[1] == slots[2]) ? slots[1] : slots[0];
-        return static_cast<double>(pairPayouts[pairSymbol]);
-    }
-
-    return 0.0;
-}
-
 GameState SlotsGame::playRound(Player &player) {
     slots = {-1, -1, -1};
     lastScore = -1;
@@ -159,18 +143,11 @@ GameState SlotsGame::playRound(Player &player) {
                         player.placeBet(selectedBet);
                     }
 
-                    std::array<int, 3> finalSlots = spinSlots();
-                    animateSpin(player, finalSlots);
+                    const RoundOutcome outcome = engine.resolveRound(BetSlip::single(selectedBet), random);
+                    animateSpin(player, engine.getReels());
 
-                    double multiplier = calculateMultiplier(finalSlots);
-
-                    if (multiplier > 0.0) {
-                        player.winBet(multiplier);
-                        lastScore = static_cast<int>(selectedBet * multiplier);
-                    } else {
-                        player.loseBet();
-                        lastScore = 0;
-                    }
+                    player.settleBet(static_cast<int>(outcome.paid));
+                    lastScore = static_cast<int>(outcome.paid);
 
                 } catch (const std::invalid_argument& e) {
                     errorMessage = "Bet error: " + std::string(e.what());
@@ -247,7 +224,7 @@ void SlotsGame::displayPayouts() const {
     for (size_t i = 0; i < TextRes::SLOT_SYMBOLS.size(); ++i) {
         std::string symbol = TextRes::SLOT_SYMBOLS[i];
         std::string line = symbol + " " + symbol + " " + symbol +
-                          "  ->  x" + std::to_string(tripletPayouts[i]);
+                          "  ->  x" + std::to_string(SlotsRules::TRIPLET_PAYOUTS[i]);
         payoutInfo.emplace_back(line);
     }
 
@@ -257,7 +234,7 @@ void SlotsGame::displayPayouts() const {
     for (size_t i = 0; i < TextRes::SLOT_SYMBOLS.size(); ++i) {
         std::string symbol = TextRes::SLOT_SYMBOLS[i];
         std::string line = symbol + " " + symbol + " ?  ->  x" +
-                          std::to_string(pairPayouts[i]);
+                          std::to_string(SlotsRules::PAIR_PAYOUTS[i]);
         payoutInfo.emplace_back(line);
     }
 
@@ -273,7 +250,10 @@ void SlotsGame::animateSpin(const Player& player, const std::array<int, 3>& fina
     };
 
     int maxSpins = std::max(spinCounts[0], std::max(spinCounts[1], spinCounts[2]));
+    const auto& symbols = measuredSymbols();
+    std::vector<MeasuredText> displaySymbols(3);
 
+    AnimationTimeline timeline;
     for (int spin = 0; spin < maxSpins; ++spin) {
         std::array<int, 3> currentSlots = slots;
 
@@ -285,12 +265,11 @@ void SlotsGame::animateSpin(const Player& player, const std::array<int, 3>& fina
             }
         }
 
-        RoundUI::clear();
-        std::vector<std::string> displaySymbols = {
-            TextRes::SLOT_SYMBOLS[currentSlots[0]],
-            TextRes::SLOT_SYMBOLS[currentSlots[1]],
-            TextRes::SLOT_SYMBOLS[currentSlots[2]]
-        };
+        const std::chrono::milliseconds delay(50 + (spin * 10));
+        if (!timeline.nextFrame(delay, spin + 1 == maxSpins)) continue;
+
+        ui.beginFrame();
+        for (int i = 0; i < 3; ++i) displaySymbols[i] = symbols[currentSlots[i]];
         ui.renderSlots(displaySymbols);
 
         std::vector<std::string> info;
@@ -298,10 +277,9 @@ void SlotsGame::animateSpin(const Player& player, const std::array<int, 3>& fina
         info.emplace_back("Current bet: " + std::to_string(player.getCurrentBet()));
         info.emplace_back("SPINNING...");
         ui.drawBox("", info);
-
-        int delay = 50 + (spin * 10); // ms
-        RoundUI::pause(delay);
+        ui.presentFrame();
     }
+    timeline.finish();
 
     slots = finalSlots;
 }
\ No newline at end of file
@@ -12,6 +12,7 @@
 #ifndef KASYNO_SLOTSGAME_H
 #define KASYNO_SLOTSGAME_H
 #include "Game.h"
+#include "SlotsEngine.h"
 #include <array>
 
 /**
@@ -23,6 +24,9 @@
  * - Payouts for pairs and triples
  * - Animated reel spinning
  * - Quick bet options
+ *
+ * Rounds are resolved by SlotsEngine; the game only adds input,
+ * animation and rendering.
  */
 class SlotsGame: public Game {
 private:
@@ -33,12 +37,6 @@ private:
      */
     int askForBet(Player& player) override;
 
-    /**
-     * @brief Spins the slot machine reels
-     * @return std::array<int, 3> Result symbols for each reel
-     */
-    std::array<int, 3> spinSlots();
-
     /**
      * @brief Renders slots game interface
      * @param player Current player
@@ -46,13 +44,6 @@ private:
      */
     int renderInterface(const Player& player) override;
 
-    /**
-     * @brief Calculates win multiplier based on slot results
-     * @param slots Array of symbol indices
-     * @return double Win multiplier (0.0 if lost)
-     */
-    double calculateMultiplier(const std::array<int, 3>& slots);
-
     /**
      * @brief Displays slots payout table
      */
@@ -65,10 +56,9 @@ private:
      */
     void animateSpin(const Player& player, const std::array<int, 3>& finalSlots);
 
+    SlotsEngine engine;                        ///< Rules engine resolving the spins
     std::array<int, 3> slots = {-1, -1, -1};  ///< Current slot symbols
     int lastScore = -1;                        ///< Last round's score
-    const int tripletPayouts[6] = {3, 5, 10, 20, 50, 100};  ///< Payouts for three matching symbols
-    const int pairPayouts[6] = {1, 1, 2, 2, 3, 5};          ///< Payouts for two matching symbols
 public:
     /**
      * @brief Constructor
@@ -0,0 +1,168 @@
+/**
+ * @file SlotsOdds.h
+ * @brief Exact, compile-time evaluation of the slots paytable
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_SLOTSODDS_H
+#define KASYNO_SLOTSODDS_H
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+#include "SlotsRules.h"
+
+/**
+ * @struct SlotsOdds
+ * @brief Exact distribution of the slot machine payout for a unit bet
+ *
+ * All counts are integer weights over the full weighted outcome space
+ * (SYMBOL_WEIGHTS total ^ REEL_COUNT), so probabilities are exact
+ * fractions with denominator totalWeight.
+ */
+struct SlotsOdds {
+    uint64_t totalWeight = 0;        ///< Weight of the whole outcome space
+    uint64_t missWeight = 0;         ///< Weight of non-paying outcomes
+    uint64_t returnWeight = 0;       ///< Sum of weight * multiplier
+    uint64_t returnSquaredWeight = 0;///< Sum of weight * multiplier^2
+    std::array<uint64_t, SlotsRules::SYMBOL_COUNT> tripleWeight{};  ///< Weight of triples per symbol
+    std::array<uint64_t, SlotsRules::SYMBOL_COUNT> pairWeight{};    ///< Weight of pairs per symbol
+
+    /**
+     * @brief Enumerates every reel combination of SlotsRules
+     * @return SlotsOdds Exact weights
+     */
+    static constexpr SlotsOdds compute() {
+        SlotsOdds odds;
+
+        for (int a = 0; a < SlotsRules::SYMBOL_COUNT; ++a) {
+            for (int b = 0; b < SlotsRules::SYMBOL_COUNT; ++b) {
+                for (int c = 0; c < SlotsRules::SYMBOL_COUNT; ++c) {
+                    const uint64_t weight =
+                        static_cast<uint64_t>(SlotsRules::SYMBOL_WEIGHTS[a]) *
+                        static_cast<uint64_t>(SlotsRules::SYMBOL_WEIGHTS[b]) *
+                        static_cast<uint64_t>(SlotsRules::SYMBOL_WEIGHTS[c]);
+
+                    const SlotsOutcome outcome = SlotsRules::evaluate({a, b, c});
+                    const uint64_t multiplier = static_cast<uint64_t>(outcome.multiplier);
+
+                    odds.totalWeight += weight;
+                    odds.returnWeight += weight * multiplier;
+                    odds.returnSquaredWeight += weight * multiplier * multiplier;
+
+                    switch (outcome.kind) {
+                        case SlotsOutcomeKind::TRIPLE:
+                            odds.tripleWeight[outcome.symbol] += weight;
+                            break;
+                        case SlotsOutcomeKind::PAIR:
+                            odds.pairWeight[outcome.symbol] += weight;
+                            break;
+                        default:
+                            odds.missWeight += weight;
+                            break;
+                    }
+                }
+            }
+        }
+
+        return odds;
+    }
+
+    /**
+     * @brief Return to player (expected multiplier)
+     * @return double RTP as a fraction (0.95 = 95%)
+     */
+    constexpr double rtp() const {
+        return static_cast<double>(returnWeight) / static_cast<double>(totalWeight);
+    }
+
+    /**
+     * @brief Probability that a spin pays anything
+     * @return double Hit frequency
+     */
+    constexpr double hitFrequency() const {
+        return static_cast<double>(totalWeight - missWeight) / static_cast<double>(totalWeight);
+    }
+
+    /**
+     * @brief Variance of the multiplier for a unit bet
+     * @return double Variance
+     */
+    constexpr double variance() const {
+        const double mean = rtp();
+        return static_cast<double>(returnSquaredWeight) / static_cast<double>(totalWeight) - mean * mean;
+    }
+
+    /**
+     * @brief Expected payout for a given bet
+     * @param bet Bet amount
+     * @return double Expected amount returned to the player
+     */
+    constexpr double expectedReturn(int bet) const { return rtp() * bet; }
+
+    /**
+     * @brief Expected player profit (negative = house edge) for a given bet
+     * @param bet Bet amount
+     * @return double Expected net result
+     */
+    constexpr double expectedValue(int bet) const { return (rtp() - 1.0) * bet; }
+
+    /**
+     * @brief Variance of the payout for a given bet
+     * @param bet Bet amount
+     * @return double Variance
+     */
+    constexpr double variance(int bet) const {
+        return variance() * static_cast<double>(bet) * static_cast<double>(bet);
+    }
+
+    /**
+     * @brief Volatility index: z * standard deviation of a single spin
+     * @param bet Bet amount
+     * @param z Standard normal quantile (1.645 = 90% confidence, industry default)
+     * @return double Volatility index
+     */
+    double volatilityIndex(int bet = 1, double z = 1.645) const {
+        return z * std::sqrt(variance(bet));
+    }
+};
+
+/// @brief Exact odds of the current paytable, evaluated at compile time
+inline constexpr SlotsOdds SLOTS_EXACT_ODDS = SlotsOdds::compute();
+
+static_assert([] {
+    uint64_t classified = SLOTS_EXACT_ODDS.missWeight;
+    for (int i = 0; i < SlotsRules::SYMBOL_COUNT; ++i) {
+        classified += SLOTS_EXACT_ODDS.tripleWeight[i] + SLOTS_EXACT_ODDS.pairWeight[i];
+    }
+    return classified == SLOTS_EXACT_ODDS.totalWeight;
+}(), "Every slots outcome must be a miss, a pair or a triple");
+
+static_assert([] {
+    uint64_t total = 0;
+    for (const int weight : SlotsRules::SYMBOL_WEIGHTS) total += static_cast<uint64_t>(weight);
+
+    for (int i = 0; i < SlotsRules::SYMBOL_COUNT; ++i) {
+        const uint64_t weight = static_cast<uint64_t>(SlotsRules::SYMBOL_WEIGHTS[i]);
+        if (SLOTS_EXACT_ODDS.tripleWeight[i] != weight * weight * weight) return false;
+        if (SLOTS_EXACT_ODDS.pairWeight[i] != 3 * weight * weight * (total - weight)) return false;
+    }
+    return SLOTS_EXACT_ODDS.totalWeight == total * total * total;
+}(), "Triple and pair weights must match w^3 and 3w^2(T-w)");
+
+// Figures of the current paytable; update them together with SlotsRules
+static_assert(SLOTS_EXACT_ODDS.returnWeight == 1'045'109 && SLOTS_EXACT_ODDS.rtp() == 1.045109,
+              "RTP is 104.5109%");
+static_assert(SLOTS_EXACT_ODDS.totalWeight - SLOTS_EXACT_ODDS.missWeight == 661'720 &&
+              SLOTS_EXACT_ODDS.hitFrequency() == 0.66172, "hit frequency is 66.172%");
+static_assert(SLOTS_EXACT_ODDS.returnSquaredWeight == 3'021'897 &&
+              SLOTS_EXACT_ODDS.variance() > 1.929644 && SLOTS_EXACT_ODDS.variance() < 1.929645,
+              "variance is 3.021897 - 1.045109^2 = 1.9296442");
+
+#endif //KASYNO_SLOTSODDS_H
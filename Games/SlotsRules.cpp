@@ -0,0 +1,21 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "SlotsRules.h"
+
+const AliasSampler& SlotsRules::symbolSampler() {
+    static const AliasSampler sampler(
+        std::vector<uint32_t>(SYMBOL_WEIGHTS.begin(), SYMBOL_WEIGHTS.end())
+    );
+    return sampler;
+}
+
+int SlotsRules::drawSymbol(Rng& rng) {
+    return symbolSampler().sample(rng);
+}
+
+SlotsRules::Reels SlotsRules::spin(Rng& rng) {
+    const AliasSampler& sampler = symbolSampler();
+    return {sampler.sample(rng), sampler.sample(rng), sampler.sample(rng)};
+}
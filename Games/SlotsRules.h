@@ -0,0 +1,103 @@
+/**
+ * @file SlotsRules.h
+ * @brief Pure slot machine rules shared by the game and the simulators
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_SLOTSRULES_H
+#define KASYNO_SLOTSRULES_H
+
+#include <array>
+
+#include "../AliasSampler.h"
+#include "../Rng.h"
+
+/**
+ * @enum SlotsOutcomeKind
+ * @brief Kind of winning combination on the reels
+ */
+enum class SlotsOutcomeKind {
+    NONE = 0,   ///< No matching symbols
+    PAIR,       ///< Two matching symbols
+    TRIPLE,     ///< Three matching symbols
+};
+
+/**
+ * @struct SlotsOutcome
+ * @brief Result of evaluating a set of reels against the paytable
+ */
+struct SlotsOutcome {
+    SlotsOutcomeKind kind;  ///< Kind of combination
+    int symbol;             ///< Matched symbol index (-1 if none)
+    int multiplier;         ///< Payout multiplier (0 if lost)
+};
+
+/**
+ * @class SlotsRules
+ * @brief Paytable, symbol weights and reel evaluation for the slot machine
+ *
+ * Contains no UI state, so it can be used both by SlotsGame
+ * and by headless tools (simulator, RTP calculator).
+ */
+class SlotsRules {
+public:
+    static constexpr int SYMBOL_COUNT = 6;  ///< Number of different symbols
+    static constexpr int REEL_COUNT = 3;    ///< Number of reels
+
+    using Reels = std::array<int, REEL_COUNT>;  ///< Symbol index on each reel
+
+    /// @brief Relative weight of each symbol on a reel
+    static constexpr std::array<int, SYMBOL_COUNT> SYMBOL_WEIGHTS = {40, 30, 15, 10, 4, 1};
+
+    /// @brief Payouts for three matching symbols
+    static constexpr std::array<int, SYMBOL_COUNT> TRIPLET_PAYOUTS = {3, 5, 10, 20, 50, 100};
+
+    /// @brief Payouts for two matching symbols
+    static constexpr std::array<int, SYMBOL_COUNT> PAIR_PAYOUTS = {1, 1, 2, 2, 3, 5};
+
+    /**
+     * @brief Gets the alias table built from SYMBOL_WEIGHTS (built on first use)
+     * @return const AliasSampler& Symbol sampler
+     */
+    static const AliasSampler& symbolSampler();
+
+    /**
+     * @brief Draws a single reel symbol according to SYMBOL_WEIGHTS
+     * @param rng Random number generator
+     * @return int Symbol index
+     */
+    static int drawSymbol(Rng& rng);
+
+    /**
+     * @brief Spins all reels
+     * @param rng Random number generator
+     * @return Reels Result symbols for each reel
+     */
+    static Reels spin(Rng& rng);
+
+    /**
+     * @brief Evaluates reels against the paytable
+     * @param reels Symbol indices on each reel
+     * @return SlotsOutcome Matched combination and its multiplier
+     */
+    static constexpr SlotsOutcome evaluate(const Reels& reels) {
+        if (reels[0] == reels[1] && reels[1] == reels[2]) {
+            return {SlotsOutcomeKind::TRIPLE, reels[0], TRIPLET_PAYOUTS[reels[0]]};
+        }
+
+        if (reels[0] == reels[1] || reels[1] == reels[2] || reels[0] == reels[2]) {
+            int pairSymbol = (reels[0] == reels[1]) ? reels[0] :
+                             (reels[1] == reels[2]) ? reels[1] : reels[0];
+            return {SlotsOutcomeKind::PAIR, pairSymbol, PAIR_PAYOUTS[pairSymbol]};
+        }
+
+        return {SlotsOutcomeKind::NONE, -1, 0};
+    }
+};
+
+#endif //KASYNO_SLOTSRULES_H
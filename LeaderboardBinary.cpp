@@ -0,0 +1,198 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "LeaderboardBinary.h"
+#include "DurableFile.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(std::endian::native == std::endian::little, "binary leaderboard is little-endian");
+
+LeaderboardView::LeaderboardView(const std::string& path) {
+#ifdef _WIN32
+    fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                             OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        fileHandle = nullptr;
+        throw std::runtime_error("LeaderboardView: cannot open '" + path + "'");
+    }
+
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(fileHandle, &fileSize);
+    length = static_cast<size_t>(fileSize.QuadPart);
+
+    if (length > 0) {
+        mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* view = mappingHandle ? MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!view) {
+            close();
+            throw std::runtime_error("LeaderboardView: cannot map '" + path + "'");
+        }
+        data = static_cast<const std::byte*>(view);
+    }
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("LeaderboardView: cannot open '" + path + "'");
+    }
+
+    struct stat info{};
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw std::runtime_error("LeaderboardView: cannot stat '" + path + "'");
+    }
+    length = static_cast<size_t>(info.st_size);
+
+    if (length > 0) {
+        void* view = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("LeaderboardView: cannot map '" + path + "'");
+        }
+        data = static_cast<const std::byte*>(view);
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+#endif
+
+    LeaderboardFileHeader header;
+    if (length < sizeof(header)) {
+        close();
+        throw std::runtime_error("LeaderboardView: '" + path + "' is too small for a leaderboard");
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    if (header.magic != LeaderboardFileHeader::MAGIC) {
+        close();
+        throw std::runtime_error("LeaderboardView: '" + path + "' is not a binary leaderboard");
+    }
+    if (header.version != LeaderboardFileHeader::VERSION) {
+        close();
+        throw std::runtime_error("LeaderboardView: unsupported version " + std::to_string(header.version));
+    }
+
+    const uint64_t recordsEnd = sizeof(header) + static_cast<uint64_t>(header.count) * sizeof(LeaderboardRecord);
+    if (recordsEnd > header.poolOffset || header.poolOffset > length ||
+        header.poolSize > length - header.poolOffset) {
+        close();
+        throw std::runtime_error("LeaderboardView: '" + path + "' is truncated or corrupted");
+    }
+
+    records = reinterpret_cast<const LeaderboardRecord*>(data + sizeof(header));
+    pool = reinterpret_cast<const char*>(data + header.poolOffset);
+    count = header.count;
+
+    for (uint32_t i = 0; i < count; ++i) {
+        if (static_cast<uint64_t>(records[i].nameOffset) + records[i].nameLength > header.poolSize) {
+            close();
+            throw std::runtime_error("LeaderboardView: record " + std::to_string(i) + " points outside the names");
+        }
+    }
+}
+
+LeaderboardView::~LeaderboardView() {
+    close();
+}
+
+LeaderboardView::LeaderboardView(LeaderboardView&& other) noexcept {
+    *this = std::move(other);
+}
+
+LeaderboardView& LeaderboardView::operator=(LeaderboardView&& other) noexcept {
+    if (this != &other) {
+        close();
+        data = std::exchange(other.data, nullptr);
+        length = std::exchange(other.length, 0);
+        records = std::exchange(other.records, nullptr);
+        pool = std::exchange(other.pool, nullptr);
+        count = std::exchange(other.count, 0);
+#ifdef _WIN32
+        fileHandle = std::exchange(other.fileHandle, nullptr);
+        mappingHandle = std::exchange(other.mappingHandle, nullptr);
+#endif
+    }
+    return *this;
+}
+
+void LeaderboardView::close() {
+#ifdef _WIN32
+    if (data) UnmapViewOfFile(data);
+    if (mappingHandle) CloseHandle(mappingHandle);
+    if (fileHandle) CloseHandle(fileHandle);
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    if (data) munmap(const_cast<std::byte*>(data), length);
+#endif
+    data = nullptr;
+    length = 0;
+    records = nullptr;
+    pool = nullptr;
+    count = 0;
+}
+
+bool LeaderboardBinary::write(const std::string& path, const std::vector<LeaderboardEntry>& entries) {
+    if (entries.size() > std::numeric_limits<uint32_t>::max()) {
+        throw std::invalid_argument(
+            "LeaderboardBinary::write: too many entries (" + std::to_string(entries.size()) + ")"
+        );
+    }
+
+    std::vector<LeaderboardRecord> records;
+    records.reserve(entries.size());
+
+    uint64_t poolSize = 0;
+    for (const LeaderboardEntry& entry : entries) {
+        if (poolSize + entry.name.size() > std::numeric_limits<uint32_t>::max()) {
+            throw std::invalid_argument("LeaderboardBinary::write: names exceed 4 GiB");
+        }
+        records.push_back(LeaderboardRecord{
+            entry.balance,
+            static_cast<uint32_t>(poolSize),
+            static_cast<uint32_t>(entry.name.size())
+        });
+        poolSize += entry.name.size();
+    }
+
+    LeaderboardFileHeader header;
+    header.count = static_cast<uint32_t>(records.size());
+    header.poolOffset = sizeof(header) + records.size() * sizeof(LeaderboardRecord);
+    header.poolSize = poolSize;
+
+    std::string bytes(header.poolOffset + poolSize, '\0');
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    std::memcpy(bytes.data() + sizeof(header), records.data(), records.size() * sizeof(LeaderboardRecord));
+
+    char* names = bytes.data() + header.poolOffset;
+    for (const LeaderboardEntry& entry : entries) {
+        names = std::copy(entry.name.begin(), entry.name.end(), names);
+    }
+
+    return DurableFile::replace(path, bytes);
+}
+
+size_t LeaderboardBinary::convertText(const std::string& textPath, const std::string& binaryPath) {
+    const std::vector<LeaderboardEntry> entries = LeaderboardStore(textPath).entries();
+
+    if (!write(binaryPath, entries)) {
+        throw std::runtime_error("LeaderboardBinary::convertText: cannot write '" + binaryPath + "'");
+    }
+
+    return entries.size();
+}
@@ -0,0 +1,175 @@
+/**
+ * @file LeaderboardBinary.h
+ * @brief Versioned binary leaderboard format read through a memory mapping
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_LEADERBOARDBINARY_H
+#define KASYNO_LEADERBOARDBINARY_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "LeaderboardStore.h"
+
+/**
+ * @struct LeaderboardFileHeader
+ * @brief First bytes of a binary leaderboard file
+ *
+ * Layout: header, `count` records, then the string pool holding
+ * all names back to back (not null-terminated). Little-endian.
+ */
+struct LeaderboardFileHeader {
+    static constexpr std::array<char, 8> MAGIC = {'K', 'A', 'S', 'Y', 'N', 'O', 'L', 'B'};  ///< File signature
+    static constexpr uint32_t VERSION = 1;  ///< Current format version
+
+    std::array<char, 8> magic = MAGIC;  ///< File signature
+    uint32_t version = VERSION;         ///< Format version
+    uint32_t count = 0;                 ///< Number of records
+    uint64_t poolOffset = 0;            ///< Byte offset of the string pool
+    uint64_t poolSize = 0;              ///< Size of the string pool in bytes
+};
+
+/**
+ * @struct LeaderboardRecord
+ * @brief Fixed-size leaderboard record
+ */
+struct LeaderboardRecord {
+    int32_t balance = 0;      ///< Player's balance
+    uint32_t nameOffset = 0;  ///< Name position in the string pool
+    uint32_t nameLength = 0;  ///< Name length in bytes
+};
+
+static_assert(sizeof(LeaderboardFileHeader) == 32, "header layout is part of the file format");
+static_assert(sizeof(LeaderboardRecord) == 12, "record layout is part of the file format");
+
+/**
+ * @class LeaderboardView
+ * @brief Read-only, memory-mapped binary leaderboard
+ *
+ * Opening validates the header and every record once; after that
+ * names are string_views into the mapping and nothing is allocated
+ * per entry. Records are stored highest balance first.
+ */
+class LeaderboardView {
+private:
+    const std::byte* data = nullptr;                ///< Start of the mapping
+    size_t length = 0;                              ///< Mapping size in bytes
+    const LeaderboardRecord* records = nullptr;     ///< Record array
+    const char* pool = nullptr;                     ///< String pool
+    uint32_t count = 0;                             ///< Number of records
+#ifdef _WIN32
+    void* fileHandle = nullptr;                     ///< Windows file handle
+    void* mappingHandle = nullptr;                  ///< Windows file mapping handle
+#endif
+
+    /**
+     * @brief Unmaps the file and closes handles
+     */
+    void close();
+
+public:
+    /**
+     * @brief Constructor - empty view
+     */
+    LeaderboardView() = default;
+
+    /**
+     * @brief Constructor - maps a binary leaderboard file
+     * @param path File path
+     * @throws std::runtime_error if the file cannot be mapped or is not a valid leaderboard
+     */
+    explicit LeaderboardView(const std::string& path);
+
+    /**
+     * @brief Destructor - unmaps the file
+     */
+    ~LeaderboardView();
+
+    LeaderboardView(const LeaderboardView&) = delete;
+    LeaderboardView& operator=(const LeaderboardView&) = delete;
+
+    /**
+     * @brief Move constructor
+     * @param other View to take the mapping from
+     */
+    LeaderboardView(LeaderboardView&& other) noexcept;
+
+    /**
+     * @brief Move assignment
+     * @param other View to take the mapping from
+     * @return LeaderboardView& This view
+     */
+    LeaderboardView& operator=(LeaderboardView&& other) noexcept;
+
+    /**
+     * @brief Gets the number of entries
+     * @return size_t Entry count
+     */
+    size_t size() const { return count; }
+
+    /**
+     * @brief Checks if the view has no entries
+     * @return bool True if empty
+     */
+    bool empty() const { return count == 0; }
+
+    /**
+     * @brief Gets a player's name
+     * @param i Entry index (0 = highest balance)
+     * @return std::string_view Name, valid while the view is open
+     */
+    std::string_view name(size_t i) const {
+        return {pool + records[i].nameOffset, records[i].nameLength};
+    }
+
+    /**
+     * @brief Gets a player's balance
+     * @param i Entry index (0 = highest balance)
+     * @return int Balance
+     */
+    int balance(size_t i) const { return records[i].balance; }
+
+    /**
+     * @brief Copies an entry out of the mapping
+     * @param i Entry index
+     * @return LeaderboardEntry Entry
+     */
+    LeaderboardEntry entry(size_t i) const { return {std::string(name(i)), balance(i)}; }
+};
+
+/**
+ * @class LeaderboardBinary
+ * @brief Writes binary leaderboards and converts text ones
+ */
+class LeaderboardBinary {
+public:
+    /**
+     * @brief Writes entries as a binary leaderboard (atomic, flushed to the disk)
+     * @param path Output file
+     * @param entries Entries, highest balance first
+     * @return bool True if written successfully
+     * @throws std::invalid_argument if there are too many entries or names
+     */
+    static bool write(const std::string& path, const std::vector<LeaderboardEntry>& entries);
+
+    /**
+     * @brief Converts a "name||balance" text leaderboard to the binary format
+     * @param textPath Text leaderboard
+     * @param binaryPath Output file
+     * @return size_t Number of players written
+     * @throws std::runtime_error if the output cannot be written
+     */
+    static size_t convertText(const std::string& textPath, const std::string& binaryPath);
+};
+
+#endif //KASYNO_LEADERBOARDBINARY_H
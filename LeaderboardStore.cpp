@@ -0,0 +1,543 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "LeaderboardStore.h"
+#include "DurableFile.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <system_error>
+
+LeaderboardStore::LeaderboardStore(std::string filename): filename(std::move(filename)),
+    journalName(this->filename + ".journal"),
+    lockName(this->filename + ".lock") {
+    FileLock lock(lockName);
+    loadAll();
+}
+
+bool LeaderboardStore::before(const LeaderboardEntry& a, const LeaderboardEntry& b) {
+    if (a.balance != b.balance) return a.balance > b.balance;
+    return a.name < b.name;
+}
+
+uint32_t LeaderboardStore::priorityOf(const std::string& name) {
+    // SplitMix64 finalizer, std::hash alone may be the identity for short keys
+    uint64_t z = std::hash<std::string>{}(name) + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return static_cast<uint32_t>((z ^ (z >> 31)) >> 32);
+}
+
+uint32_t LeaderboardStore::sizeOf(uint32_t node) const {
+    return node == NIL ? 0 : nodes[node].size;
+}
+
+void LeaderboardStore::update(uint32_t node) {
+    nodes[node].size = 1 + sizeOf(nodes[node].left) + sizeOf(nodes[node].right);
+}
+
+void LeaderboardStore::split(uint32_t node, const LeaderboardEntry& key, uint32_t& left, uint32_t& right) {
+    if (node == NIL) {
+        left = right = NIL;
+        return;
+    }
+
+    if (before(nodes[node].entry, key)) {
+        split(nodes[node].right, key, nodes[node].right, right);
+        left = node;
+    } else {
+        split(nodes[node].left, key, left, nodes[node].left);
+        right = node;
+    }
+
+    update(node);
+}
+
+uint32_t LeaderboardStore::merge(uint32_t left, uint32_t right) {
+    if (left == NIL) return right;
+    if (right == NIL) return left;
+
+    if (nodes[left].priority > nodes[right].priority) {
+        nodes[left].right = merge(nodes[left].right, right);
+        update(left);
+        return left;
+    }
+
+    nodes[right].left = merge(left, nodes[right].left);
+    update(right);
+    return right;
+}
+
+uint32_t LeaderboardStore::erase(uint32_t node, const LeaderboardEntry& key) {
+    if (node == NIL) return NIL;
+
+    if (nodes[node].entry.name == key.name) {
+        return merge(nodes[node].left, nodes[node].right);
+    }
+
+    if (before(key, nodes[node].entry)) {
+        nodes[node].left = erase(nodes[node].left, key);
+    } else {
+        nodes[node].right = erase(nodes[node].right, key);
+    }
+
+    update(node);
+    return node;
+}
+
+void LeaderboardStore::apply(const LeaderboardEntry& entry) {
+    uint32_t node;
+    auto it = index.find(entry.name);
+
+    if (it != index.end()) {
+        node = it->second;
+        if (nodes[node].entry.balance == entry.balance) return;
+
+        root = erase(root, nodes[node].entry);
+        nodes[node].entry.balance = entry.balance;
+    } else {
+        node = static_cast<uint32_t>(nodes.size());
+        nodes.push_back(Node{entry});
+        nodes[node].priority = priorityOf(entry.name);
+        index.emplace(entry.name, node);
+    }
+
+    nodes[node].left = nodes[node].right = NIL;
+    nodes[node].size = 1;
+
+    uint32_t left, right;
+    split(root, nodes[node].entry, left, right);
+    root = merge(merge(left, node), right);
+}
+
+void LeaderboardStore::reset() {
+    nodes.clear();
+    index.clear();
+    root = NIL;
+    snapshotSize = 0;
+    snapshotTime = {};
+    journalOffset = 0;
+    journalRecords = 0;
+    journalTorn = false;
+}
+
+bool LeaderboardStore::parseLine(std::string_view line, LeaderboardEntry& entry) {
+    size_t pos = line.find("||");
+    if (pos == std::string_view::npos) return false;
+
+    std::string_view number = line.substr(pos + 2);
+    while (!number.empty() && (number.front() == ' ' || number.front() == '\t')) number.remove_prefix(1);
+    if (!number.empty() && number.front() == '+') number.remove_prefix(1);
+
+    int balance = 0;
+    auto [end, error] = std::from_chars(number.data(), number.data() + number.size(), balance);
+    if (error != std::errc() || balance < 0) return false;
+
+    entry.name.assign(line.substr(0, pos));
+    entry.balance = balance;
+    return true;
+}
+
+void LeaderboardStore::stage(const LeaderboardEntry& entry) {
+    auto [it, inserted] = index.try_emplace(entry.name, static_cast<uint32_t>(nodes.size()));
+    if (inserted) {
+        nodes.push_back(Node{entry, priorityOf(entry.name)});
+    } else {
+        nodes[it->second].entry.balance = entry.balance;
+    }
+}
+
+uint32_t LeaderboardStore::computeSizes(uint32_t node) {
+    if (node == NIL) return 0;
+    nodes[node].size = 1 + computeSizes(nodes[node].left) + computeSizes(nodes[node].right);
+    return nodes[node].size;
+}
+
+void LeaderboardStore::build() {
+    // Balances are copied next to the node ids so most comparisons
+    // do not have to chase the node (names only break ties)
+    struct RankKey {
+        int balance;
+        uint32_t node;
+    };
+
+    std::vector<RankKey> order(nodes.size());
+    for (uint32_t i = 0; i < order.size(); ++i) order[i] = RankKey{nodes[i].entry.balance, i};
+
+    std::sort(order.begin(), order.end(), [this](const RankKey& a, const RankKey& b) {
+        if (a.balance != b.balance) return a.balance > b.balance;
+        return nodes[a.node].entry.name < nodes[b.node].entry.name;
+    });
+
+    // Entries arrive in rank order, so the treap is a Cartesian tree over
+    // the priorities, built in O(n) with a stack of the right spine.
+    std::vector<uint32_t> spine;
+    for (const RankKey& key : order) {
+        const uint32_t node = key.node;
+        uint32_t last = NIL;
+        while (!spine.empty() && nodes[spine.back()].priority < nodes[node].priority) {
+            last = spine.back();
+            spine.pop_back();
+        }
+
+        nodes[node].left = last;
+        nodes[node].right = NIL;
+        if (!spine.empty()) nodes[spine.back()].right = node;
+        spine.push_back(node);
+    }
+
+    root = spine.empty() ? NIL : spine.front();
+    computeSizes(root);
+}
+
+std::string LeaderboardStore::readFrom(const std::string& path, uint64_t offset) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) return {};
+
+    const auto end = static_cast<uint64_t>(file.tellg());
+    if (end <= offset) return {};
+
+    std::string buffer(end - offset, '\0');
+    file.seekg(static_cast<std::streamoff>(offset));
+    file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    buffer.resize(static_cast<size_t>(file.gcount()));
+    return buffer;
+}
+
+uint32_t LeaderboardStore::checksum(std::string_view data) {
+    static constexpr auto TABLE = [] {
+        std::array<uint32_t, 256> table{};
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; ++bit) crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320u : 0u);
+            table[i] = crc;
+        }
+        return table;
+    }();
+
+    uint32_t crc = 0xFFFFFFFFu;
+    for (char c : data) crc = (crc >> 8) ^ TABLE[(crc ^ static_cast<uint8_t>(c)) & 0xFFu];
+    return ~crc;
+}
+
+std::string LeaderboardStore::journalRecord(const LeaderboardEntry& entry) {
+    std::string record = entry.name + "||" + std::to_string(entry.balance);
+
+    char crc[9];
+    std::snprintf(crc, sizeof(crc), "%08x", checksum(record));
+    return record + "||" + crc + "\n";
+}
+
+bool LeaderboardStore::parseJournalLine(std::string_view line, LeaderboardEntry& entry) {
+    const size_t pos = line.rfind("||");
+    if (pos == std::string_view::npos || line.size() - pos != 10) return false;
+
+    uint32_t crc = 0;
+    const char* digits = line.data() + pos + 2;
+    auto [end, error] = std::from_chars(digits, digits + 8, crc, 16);
+    if (error != std::errc() || end != digits + 8) return false;
+
+    const std::string_view record = line.substr(0, pos);
+    return checksum(record) == crc && parseLine(record, entry);
+}
+
+uint64_t LeaderboardStore::applyLines(std::string_view text, bool journal) {
+    // Loading into an empty store sorts once instead of inserting one by one
+    const bool bulk = root == NIL;
+    if (bulk) {
+        const auto lines = static_cast<size_t>(std::count(text.begin(), text.end(), '\n'));
+        index.reserve(lines);
+        nodes.reserve(lines);
+    }
+
+    uint64_t consumed = 0;
+    LeaderboardEntry entry;
+    while (consumed < text.size()) {
+        const size_t newline = text.find('\n', consumed);
+
+        // A journal record without its newline is still being written or was torn by a crash
+        if (newline == std::string_view::npos && journal) break;
+
+        const size_t lineEnd = newline == std::string_view::npos ? text.size() : newline;
+        std::string_view line = text.substr(consumed, lineEnd - consumed);
+        consumed = newline == std::string_view::npos ? text.size() : newline + 1;
+
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+        const bool valid = journal ? parseJournalLine(line, entry) : parseLine(line, entry);
+        if (journal) ++journalRecords;
+        if (!valid) continue;
+
+        if (bulk) {
+            stage(entry);
+        } else {
+            apply(entry);
+        }
+    }
+
+    if (bulk) build();
+    return consumed;
+}
+
+void LeaderboardStore::loadAll() {
+    reset();
+
+    stampSnapshot();
+    applyLines(readFrom(filename, 0), false);
+
+    const std::string journal = readFrom(journalName, 0);
+    journalOffset = applyLines(journal, true);
+    journalTorn = journalOffset < journal.size();
+}
+
+bool LeaderboardStore::stampSnapshot() {
+    std::error_code error;
+    const uint64_t size = std::filesystem::file_size(filename, error);
+    const auto time = error ? std::filesystem::file_time_type{} : std::filesystem::last_write_time(filename, error);
+
+    const uint64_t newSize = error ? 0 : size;
+    const auto newTime = error ? std::filesystem::file_time_type{} : time;
+    const bool changed = newSize != snapshotSize || newTime != snapshotTime;
+
+    snapshotSize = newSize;
+    snapshotTime = newTime;
+    return changed;
+}
+
+void LeaderboardStore::refreshLocked() {
+    // A new snapshot means another process compacted or replaced the leaderboard
+    if (stampSnapshot()) {
+        loadAll();
+        return;
+    }
+
+    std::error_code sizeError;
+    const uint64_t journalSize = std::filesystem::file_size(journalName, sizeError);
+    if (sizeError ? journalOffset > 0 : journalSize < journalOffset) {
+        loadAll();
+        return;
+    }
+
+    if (!sizeError && journalSize > journalOffset) {
+        const std::string tail = readFrom(journalName, journalOffset);
+        journalOffset += applyLines(tail, true);
+        journalTorn = journalOffset < journalSize;
+    }
+}
+
+void LeaderboardStore::refresh() {
+    FileLock lock(lockName);
+    refreshLocked();
+}
+
+bool LeaderboardStore::isValid(const LeaderboardEntry& entry) {
+    return entry.balance >= 0 && !entry.name.empty() && entry.name.find('\n') == std::string::npos &&
+           entry.name.find('\r') == std::string::npos && entry.name.find("||") == std::string::npos;
+}
+
+bool LeaderboardStore::upsert(const LeaderboardEntry& entry) {
+    return isValid(entry) && upsertBatch({entry});
+}
+
+bool LeaderboardStore::upsertBatch(const std::vector<LeaderboardEntry>& batch) {
+    FileLock lock(lockName);
+    if (!lock) return false;
+
+    refreshLocked();
+
+    bool allValid = true;
+    std::vector<const LeaderboardEntry*> changed;
+    std::string records;
+    for (const LeaderboardEntry& entry : batch) {
+        if (!isValid(entry)) {
+            allValid = false;
+            continue;
+        }
+
+        auto it = index.find(entry.name);
+        if (it != index.end() && nodes[it->second].entry.balance == entry.balance) continue;
+
+        records += journalRecord(entry);
+        changed.push_back(&entry);
+    }
+
+    if (changed.empty()) return allValid;
+
+    // Nobody else is writing while we hold the lock, so a torn tail is left
+    // over from a crash: end it with a newline so it stays one bad record
+    if (journalTorn) records.insert(records.begin(), '\n');
+
+    if (!DurableFile::append(journalName, records)) return false;
+
+    std::error_code error;
+    journalOffset = std::filesystem::file_size(journalName, error);
+    journalTorn = false;
+    journalRecords += changed.size();
+    for (const LeaderboardEntry* entry : changed) apply(*entry);
+
+    if (journalRecords >= COMPACT_MIN_RECORDS && journalRecords >= size()) {
+        compactLocked();
+    }
+
+    return allValid;
+}
+
+bool LeaderboardStore::contains(const std::string& name) const {
+    return index.contains(name);
+}
+
+std::optional<int> LeaderboardStore::balanceOf(const std::string& name) const {
+    auto it = index.find(name);
+    if (it == index.end()) return std::nullopt;
+    return nodes[it->second].entry.balance;
+}
+
+std::optional<size_t> LeaderboardStore::rankOf(const std::string& name) const {
+    auto it = index.find(name);
+    if (it == index.end()) return std::nullopt;
+
+    const LeaderboardEntry& key = nodes[it->second].entry;
+    size_t rank = 0;
+    uint32_t node = root;
+
+    while (node != NIL) {
+        if (nodes[node].entry.name == key.name) {
+            return rank + sizeOf(nodes[node].left);
+        }
+
+        if (before(key, nodes[node].entry)) {
+            node = nodes[node].left;
+        } else {
+            rank += sizeOf(nodes[node].left) + 1;
+            node = nodes[node].right;
+        }
+    }
+
+    return std::nullopt;
+}
+
+const LeaderboardEntry& LeaderboardStore::at(size_t rank) const {
+    if (rank >= size()) {
+        throw std::out_of_range(
+            "LeaderboardStore::at: rank (" + std::to_string(rank) +
+            ") exceeds player count (" + std::to_string(size()) + ")"
+        );
+    }
+
+    uint32_t node = root;
+    while (true) {
+        const uint32_t leftSize = sizeOf(nodes[node].left);
+
+        if (rank < leftSize) {
+            node = nodes[node].left;
+        } else if (rank == leftSize) {
+            return nodes[node].entry;
+        } else {
+            rank -= leftSize + 1;
+            node = nodes[node].right;
+        }
+    }
+}
+
+std::vector<LeaderboardEntry> LeaderboardStore::entries() const {
+    return range(0, size());
+}
+
+std::vector<LeaderboardEntry> LeaderboardStore::range(size_t first, size_t count) const {
+    std::vector<LeaderboardEntry> result;
+    if (first >= size() || count == 0) return result;
+
+    count = std::min(count, size() - first);
+    result.reserve(count);
+
+    // Walk down to the first entry, remembering the ancestors still to visit
+    std::vector<uint32_t> stack;
+    uint32_t node = root;
+    size_t skip = first;
+
+    while (node != NIL) {
+        const uint32_t leftSize = sizeOf(nodes[node].left);
+
+        if (skip < leftSize) {
+            stack.push_back(node);
+            node = nodes[node].left;
+        } else if (skip == leftSize) {
+            stack.push_back(node);
+            break;
+        } else {
+            skip -= leftSize + 1;
+            node = nodes[node].right;
+        }
+    }
+
+    while (!stack.empty() && result.size() < count) {
+        node = stack.back();
+        stack.pop_back();
+        result.push_back(nodes[node].entry);
+
+        for (node = nodes[node].right; node != NIL; node = nodes[node].left) {
+            stack.push_back(node);
+        }
+    }
+
+    return result;
+}
+
+bool LeaderboardStore::compactLocked() {
+    std::string text;
+    for (const LeaderboardEntry& entry : entries()) {
+        text += entry.name;
+        text += "||";
+        text += std::to_string(entry.balance);
+        text += '\n';
+    }
+
+    // The journal is only emptied once the snapshot holding its records is on the disk
+    if (!DurableFile::replace(filename, text)) return false;
+
+    stampSnapshot();
+
+    if (!DurableFile::replace(journalName, "")) return false;
+
+    journalOffset = 0;
+    journalRecords = 0;
+    journalTorn = false;
+    return true;
+}
+
+bool LeaderboardStore::replace(const std::vector<LeaderboardEntry>& newEntries) {
+    FileLock lock(lockName);
+    if (!lock) return false;
+
+    reset();
+
+    bool allValid = true;
+    for (const LeaderboardEntry& entry : newEntries) {
+        if (isValid(entry)) {
+            apply(entry);
+        } else {
+            allValid = false;
+        }
+    }
+
+    return compactLocked() && allValid;
+}
+
+bool LeaderboardStore::clear() {
+    return replace({});
+}
+
+bool LeaderboardStore::compact() {
+    FileLock lock(lockName);
+    if (!lock) return false;
+
+    refreshLocked();
+    return compactLocked();
+}
@@ -0,0 +1,344 @@
+/**
+ * @file LeaderboardStore.h
+ * @brief Indexed leaderboard kept in memory and persisted as an append-only log
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_LEADERBOARDSTORE_H
+#define KASYNO_LEADERBOARDSTORE_H
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @struct LeaderboardEntry
+ * @brief Represents a single entry in the leaderboard
+ */
+struct LeaderboardEntry {
+    std::string name;  ///< Player name
+    int balance;       ///< Player's final balance
+};
+
+/**
+ * @class LeaderboardStore
+ * @brief Leaderboard with O(1) name lookups and O(log n) ranked access
+ *
+ * Entries live in a treap ordered by balance (highest first, then name)
+ * with subtree sizes, so the k-th entry and the rank of a player are
+ * found in O(log n). A hash index maps names to treap nodes.
+ *
+ * On disk the leaderboard is a snapshot plus a write-ahead journal:
+ * - the snapshot (the leaderboard file itself) keeps the "name||balance"
+ *   text format and is only ever replaced atomically (temporary file,
+ *   fsync, rename);
+ * - every update appends one "name||balance||crc32" record to
+ *   "<file>.journal" and fsyncs it. Later records win; a record torn by
+ *   a crash fails its checksum and is skipped.
+ * Once the journal holds as many records as there are players, it is
+ * folded into a new snapshot and emptied.
+ *
+ * All file access is serialized between processes with "<file>.lock".
+ */
+class LeaderboardStore {
+public:
+    static constexpr size_t COMPACT_MIN_RECORDS = 1024;  ///< Never compact smaller journals
+
+private:
+    static constexpr uint32_t NIL = UINT32_MAX;  ///< No node
+
+    /**
+     * @struct Node
+     * @brief Treap node
+     */
+    struct Node {
+        LeaderboardEntry entry;  ///< Player name and balance
+        uint32_t priority = 0;   ///< Heap priority (hash of the name)
+        uint32_t left = NIL;     ///< Entries ranked before this one
+        uint32_t right = NIL;    ///< Entries ranked after this one
+        uint32_t size = 1;       ///< Nodes in this subtree
+    };
+
+    std::string filename;                               ///< Snapshot file
+    std::string journalName;                            ///< Journal file
+    std::string lockName;                               ///< Lock file
+    std::vector<Node> nodes;                            ///< Node pool
+    std::unordered_map<std::string, uint32_t> index;    ///< Name -> node
+    uint32_t root = NIL;                                ///< Treap root
+    uint64_t snapshotSize = 0;                          ///< Snapshot size when it was loaded
+    std::filesystem::file_time_type snapshotTime{};     ///< Snapshot modification time when it was loaded
+    uint64_t journalOffset = 0;                         ///< Bytes of the journal already applied
+    size_t journalRecords = 0;                          ///< Records in the journal
+    bool journalTorn = false;                           ///< Journal ends with an incomplete record
+
+    /**
+     * @brief Checks the ranking order
+     * @param a First entry
+     * @param b Second entry
+     * @return bool True if a ranks before b (higher balance, then name)
+     */
+    static bool before(const LeaderboardEntry& a, const LeaderboardEntry& b);
+
+    /**
+     * @brief Computes the treap priority of a name
+     * @param name Player name
+     * @return uint32_t Priority
+     */
+    static uint32_t priorityOf(const std::string& name);
+
+    /**
+     * @brief Gets the size of a subtree
+     * @param node Subtree root (may be NIL)
+     * @return uint32_t Node count
+     */
+    uint32_t sizeOf(uint32_t node) const;
+
+    /**
+     * @brief Recomputes a node's subtree size from its children
+     * @param node Node to update
+     */
+    void update(uint32_t node);
+
+    /**
+     * @brief Splits a subtree into entries ranked before a key and the rest
+     * @param node Subtree root
+     * @param key Split key
+     * @param left Output, entries ranked before key
+     * @param right Output, the other entries
+     */
+    void split(uint32_t node, const LeaderboardEntry& key, uint32_t& left, uint32_t& right);
+
+    /**
+     * @brief Joins two subtrees, all of left ranked before all of right
+     * @param left First subtree
+     * @param right Second subtree
+     * @return uint32_t Joined subtree root
+     */
+    uint32_t merge(uint32_t left, uint32_t right);
+
+    /**
+     * @brief Removes an entry from a subtree
+     * @param node Subtree root
+     * @param key Entry to remove (must be present)
+     * @return uint32_t New subtree root
+     */
+    uint32_t erase(uint32_t node, const LeaderboardEntry& key);
+
+    /**
+     * @brief Inserts or updates an entry in memory only
+     * @param entry Entry to apply
+     */
+    void apply(const LeaderboardEntry& entry);
+
+    /**
+     * @brief Adds or updates an entry before build() (bulk load)
+     * @param entry Entry to add
+     */
+    void stage(const LeaderboardEntry& entry);
+
+    /**
+     * @brief Links all staged nodes into a treap in O(n log n)
+     */
+    void build();
+
+    /**
+     * @brief Recomputes subtree sizes below a node
+     * @param node Subtree root
+     * @return uint32_t Subtree size
+     */
+    uint32_t computeSizes(uint32_t node);
+
+    /**
+     * @brief Drops all entries from memory
+     */
+    void reset();
+
+    /**
+     * @brief Reads a file from an offset to the end
+     * @param path File path
+     * @param offset First byte to read
+     * @return std::string Contents (empty if the file is missing)
+     */
+    static std::string readFrom(const std::string& path, uint64_t offset);
+
+    /**
+     * @brief Applies snapshot or journal lines
+     * @param text Lines to apply
+     * @param journal True for checksummed journal records
+     * @return uint64_t Bytes of complete lines consumed
+     */
+    uint64_t applyLines(std::string_view text, bool journal);
+
+    /**
+     * @brief Parses one "name||balance" snapshot line
+     * @param line Line without the newline
+     * @param entry Output entry
+     * @return bool True if the line is a valid entry
+     */
+    static bool parseLine(std::string_view line, LeaderboardEntry& entry);
+
+    /**
+     * @brief Parses one "name||balance||crc32" journal record
+     * @param line Line without the newline
+     * @param entry Output entry
+     * @return bool True if the record is valid and its checksum matches
+     */
+    static bool parseJournalLine(std::string_view line, LeaderboardEntry& entry);
+
+    /**
+     * @brief Formats a journal record
+     * @param entry Entry to record
+     * @return std::string Record including the newline
+     */
+    static std::string journalRecord(const LeaderboardEntry& entry);
+
+    /**
+     * @brief Computes the CRC-32 of a record
+     * @param data Bytes to check
+     * @return uint32_t Checksum
+     */
+    static uint32_t checksum(std::string_view data);
+
+    /**
+     * @brief Checks if an entry can be stored (non-negative balance, name without "||" or line breaks)
+     * @param entry Entry to check
+     * @return bool True if valid
+     */
+    static bool isValid(const LeaderboardEntry& entry);
+
+    /**
+     * @brief Records the snapshot's current size and modification time
+     * @return bool True if either differs from the recorded one
+     */
+    bool stampSnapshot();
+
+    /**
+     * @brief Reloads the snapshot and the whole journal (lock held)
+     */
+    void loadAll();
+
+    /**
+     * @brief Picks up changes made by other processes (lock held)
+     */
+    void refreshLocked();
+
+    /**
+     * @brief Writes a new snapshot and empties the journal (lock held)
+     * @return bool True if written successfully
+     */
+    bool compactLocked();
+
+public:
+    /**
+     * @brief Constructor - loads the file if it exists
+     * @param filename Backing file
+     */
+    explicit LeaderboardStore(std::string filename);
+
+    /**
+     * @brief Picks up changes made by other processes
+     *
+     * Reads new journal records, or reloads everything if the snapshot
+     * was replaced (compacted or cleared).
+     */
+    void refresh();
+
+    /**
+     * @brief Adds a player or updates their balance (one journal record)
+     * @param entry Player name and balance
+     * @return bool True if stored, false for an invalid entry or write error
+     */
+    bool upsert(const LeaderboardEntry& entry);
+
+    /**
+     * @brief Adds or updates many players with one journal write and one fsync
+     * @param batch Player names and balances (later entries win)
+     * @return bool True if all were stored; invalid entries are skipped
+     */
+    bool upsertBatch(const std::vector<LeaderboardEntry>& batch);
+
+    /**
+     * @brief Checks if a player is on the leaderboard
+     * @param name Player name
+     * @return bool True if present
+     */
+    bool contains(const std::string& name) const;
+
+    /**
+     * @brief Gets a player's balance
+     * @param name Player name
+     * @return std::optional<int> Balance, empty if the player is not present
+     */
+    std::optional<int> balanceOf(const std::string& name) const;
+
+    /**
+     * @brief Gets a player's position
+     * @param name Player name
+     * @return std::optional<size_t> 0-based rank, empty if the player is not present
+     */
+    std::optional<size_t> rankOf(const std::string& name) const;
+
+    /**
+     * @brief Gets the entry at a position
+     * @param rank 0-based rank
+     * @return const LeaderboardEntry& Entry
+     * @throws std::out_of_range if rank >= size()
+     */
+    const LeaderboardEntry& at(size_t rank) const;
+
+    /**
+     * @brief Gets the number of players
+     * @return size_t Player count
+     */
+    size_t size() const { return index.size(); }
+
+    /**
+     * @brief Gets the number of records in the journal
+     * @return size_t Records not yet folded into the snapshot
+     */
+    size_t getJournalRecords() const { return journalRecords; }
+
+    /**
+     * @brief Gets all entries, highest balance first
+     * @return std::vector<LeaderboardEntry> Sorted entries
+     */
+    std::vector<LeaderboardEntry> entries() const;
+
+    /**
+     * @brief Gets consecutive entries by rank in O(log n + count)
+     * @param first 0-based rank of the first entry
+     * @param count Maximum number of entries
+     * @return std::vector<LeaderboardEntry> Entries (fewer near the end, empty past it)
+     */
+    std::vector<LeaderboardEntry> range(size_t first, size_t count) const;
+
+    /**
+     * @brief Replaces the whole leaderboard
+     * @param newEntries New entries (later duplicates win)
+     * @return bool True if all were written; invalid entries are skipped
+     */
+    bool replace(const std::vector<LeaderboardEntry>& newEntries);
+
+    /**
+     * @brief Removes all entries and empties the file
+     * @return bool True if cleared successfully
+     */
+    bool clear();
+
+    /**
+     * @brief Folds the journal into a new snapshot
+     * @return bool True if written successfully
+     */
+    bool compact();
+};
+
+#endif //KASYNO_LEADERBOARDSTORE_H
@@ -0,0 +1,90 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "LeaderboardWriter.h"
+
+#include <utility>
+
+LeaderboardWriter::LeaderboardWriter(Sink sink): sink(std::move(sink)) {
+    worker = std::thread(&LeaderboardWriter::run, this);
+}
+
+LeaderboardWriter::~LeaderboardWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    work.notify_one();
+    worker.join();
+}
+
+void LeaderboardWriter::submit(const LeaderboardEntry& entry, const std::string& filename) {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    auto queued = [&] {
+        auto file = pending.find(filename);
+        return file != pending.end() && file->second.contains(entry.name);
+    };
+    progress.wait(lock, [&] { return pendingCount < MAX_PENDING || queued(); });
+
+    auto [it, inserted] = pending[filename].insert_or_assign(entry.name, entry.balance);
+    if (inserted) ++pendingCount;
+    ++submitted;
+
+    work.notify_one();
+}
+
+void LeaderboardWriter::wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    const uint64_t target = submitted;
+    progress.wait(lock, [&] { return written >= target; });
+}
+
+bool LeaderboardWriter::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    const uint64_t target = submitted;
+    progress.wait(lock, [&] { return written >= target; });
+
+    return !std::exchange(failed, false);
+}
+
+void LeaderboardWriter::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+        work.wait(lock, [this] { return pendingCount > 0 || stopping; });
+        if (pendingCount == 0) return;
+
+        // Take the whole queue; updates arriving meanwhile form the next batch
+        auto batch = std::move(pending);
+        pending.clear();
+        pendingCount = 0;
+        const uint64_t target = submitted;
+        progress.notify_all();
+
+        lock.unlock();
+
+        bool ok = true;
+        for (const auto& [filename, balances] : batch) {
+            std::vector<LeaderboardEntry> entries;
+            entries.reserve(balances.size());
+            for (const auto& [name, balance] : balances) {
+                entries.push_back(LeaderboardEntry{name, balance});
+            }
+
+            try {
+                ok = sink(filename, entries) && ok;
+            } catch (...) {
+                ok = false;
+            }
+        }
+
+        lock.lock();
+        written = target;
+        failed = failed || !ok;
+        progress.notify_all();
+    }
+}
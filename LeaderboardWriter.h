@@ -0,0 +1,110 @@
+/**
+ * @file LeaderboardWriter.h
+ * @brief Background thread that persists leaderboard updates in batches
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_LEADERBOARDWRITER_H
+#define KASYNO_LEADERBOARDWRITER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "LeaderboardStore.h"
+
+/**
+ * @class LeaderboardWriter
+ * @brief Moves leaderboard disk writes off the game thread
+ *
+ * submit() only queues an update and returns. The worker thread takes
+ * everything queued so far and hands it to the sink one file at a time,
+ * so a batch costs one journal write and one fsync per file.
+ *
+ * The queue holds at most MAX_PENDING players. A newer balance for a
+ * player that is still queued replaces the older one, so only players
+ * not yet queued ever wait for room.
+ *
+ * flush() is the barrier: it returns once everything submitted before
+ * the call is on the disk. The destructor flushes, then stops the thread.
+ */
+class LeaderboardWriter {
+public:
+    /**
+     * @brief Writes one batch to a leaderboard file
+     *
+     * Called on the worker thread; returns true if every entry was stored.
+     */
+    using Sink = std::function<bool(const std::string& filename, const std::vector<LeaderboardEntry>& batch)>;
+
+    static constexpr size_t MAX_PENDING = 4096;  ///< Queued players before submit() blocks
+
+private:
+    Sink sink;                                                                  ///< Batch writer
+    std::unordered_map<std::string, std::unordered_map<std::string, int>> pending;  ///< File -> name -> balance
+    size_t pendingCount = 0;       ///< Players in pending
+    uint64_t submitted = 0;        ///< Updates submitted so far
+    uint64_t written = 0;          ///< Updates the sink has finished with
+    bool failed = false;           ///< A write failed since the last flush()
+    bool stopping = false;         ///< Destructor asked the worker to exit
+
+    std::mutex mutex;                 ///< Guards the state above
+    std::condition_variable work;     ///< Signals the worker (new updates or stop)
+    std::condition_variable progress; ///< Signals waiters (batch written or room freed)
+    std::thread worker;               ///< Writer thread
+
+    /**
+     * @brief Worker loop - writes batches until stopped and drained
+     */
+    void run();
+
+public:
+    /**
+     * @brief Constructor - starts the worker thread
+     * @param sink Function that writes a batch to a file
+     */
+    explicit LeaderboardWriter(Sink sink);
+
+    /**
+     * @brief Destructor - writes everything still queued and stops the thread
+     */
+    ~LeaderboardWriter();
+
+    LeaderboardWriter(const LeaderboardWriter&) = delete;
+    LeaderboardWriter& operator=(const LeaderboardWriter&) = delete;
+
+    /**
+     * @brief Queues a player's balance for writing
+     *
+     * Blocks only while the queue is full and the player is not in it yet.
+     *
+     * @param entry Player name and balance
+     * @param filename Leaderboard file path
+     */
+    void submit(const LeaderboardEntry& entry, const std::string& filename);
+
+    /**
+     * @brief Waits until everything submitted so far is written
+     *
+     * Unlike flush() it leaves a failed write to be reported by flush().
+     */
+    void wait();
+
+    /**
+     * @brief Waits until everything submitted so far is written
+     * @return bool True if all writes since the previous flush() succeeded
+     */
+    bool flush();
+};
+
+#endif //KASYNO_LEADERBOARDWRITER_H
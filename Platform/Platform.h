@@ -0,0 +1,104 @@
+/**
+ * @file Platform.h
+ * @brief Operating system services used by the game (console, terminal, threads)
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_PLATFORM_H
+#define KASYNO_PLATFORM_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class Platform
+ * @brief Thin layer over the console and process APIs of each system
+ *
+ * Everything that needs windows.h or the POSIX headers lives behind this
+ * class, implemented in PlatformWindows.cpp or PlatformPosix.cpp (CMake
+ * compiles the one matching the target). The rest of the code includes
+ * only this header.
+ */
+class Platform {
+public:
+    using ResizeHandler = void (*)(int);  ///< Called (from a signal handler) when the terminal is resized
+
+    /**
+     * @brief Prepares the console for the UI (ANSI colors, UTF-8 text)
+     * @return bool True if everything was set up
+     */
+    static bool setupConsole();
+
+    /**
+     * @brief Makes the console interpret ANSI escape sequences
+     * @return bool True if ANSI sequences will work
+     */
+    static bool enableAnsiColors();
+
+    /**
+     * @brief Asks the system for the size of the terminal on standard output
+     * @param columns Output width (unchanged on failure)
+     * @param rows Output height (unchanged on failure)
+     * @return bool True if the output is a terminal and the size was read
+     */
+    static bool terminalSize(int& columns, int& rows);
+
+    /**
+     * @brief Registers a function called whenever the terminal is resized
+     *
+     * The handler runs in signal context and may only touch lock-free atomics.
+     * Nothing is installed if the program already handles the signal.
+     *
+     * @param handler Function to call
+     * @return bool True if resizes will be reported, false if they must be polled
+     */
+    static bool watchTerminalResize(ResizeHandler handler);
+
+    /**
+     * @brief Clears the screen and the scrollback and moves the cursor home
+     */
+    static void clearScreen();
+
+    /**
+     * @brief Moves the cursor to the center column of the current row
+     */
+    static void moveCursorToCenterColumn();
+
+    /**
+     * @brief Reads one key press without waiting for ENTER
+     *
+     * Falls back to reading a character from std::cin when standard input
+     * is not a terminal.
+     *
+     * @return int Key code, or -1 when input is closed
+     */
+    static int readKey();
+
+    /**
+     * @brief Writes a buffer to a file descriptor, retrying partial writes
+     * @param fd File descriptor (1 = standard output)
+     * @param data Bytes to write
+     * @param size Number of bytes
+     * @return size_t Number of bytes written (less than size on error)
+     */
+    static size_t writeAll(int fd, const char* data, size_t size);
+
+    /**
+     * @brief Gets the id of the current process
+     * @return uint64_t Process id
+     */
+    static uint64_t processId();
+
+    /**
+     * @brief Gets a system id of the calling thread
+     * @return uint64_t Thread id
+     */
+    static uint64_t threadId();
+};
+
+#endif //KASYNO_PLATFORM_H
@@ -0,0 +1,110 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "Platform.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <iostream>
+#include <pthread.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+
+bool Platform::setupConsole() {
+    // Terminals on POSIX systems understand ANSI and UTF-8 already
+    return true;
+}
+
+bool Platform::enableAnsiColors() {
+    return true;
+}
+
+bool Platform::terminalSize(int& columns, int& rows) {
+    struct winsize w{};
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &w) != 0) return false;
+
+    if (w.ws_col > 0) columns = w.ws_col;
+    if (w.ws_row > 0) rows = w.ws_row;
+    return w.ws_col > 0;
+}
+
+bool Platform::watchTerminalResize(ResizeHandler handler) {
+    struct sigaction current{};
+    if (sigaction(SIGWINCH, nullptr, &current) != 0) return false;
+    if (current.sa_handler != SIG_DFL && current.sa_handler != SIG_IGN) return false;
+
+    struct sigaction action{};
+    action.sa_handler = handler;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;  // a resize must not break a pending read of the user's input
+    return sigaction(SIGWINCH, &action, nullptr) == 0;
+}
+
+void Platform::clearScreen() {
+    std::cout << "\x1b[H\x1b[2J\x1b[3J" << std::flush;
+}
+
+void Platform::moveCursorToCenterColumn() {
+    int columns = 0, rows = 0;
+    if (!terminalSize(columns, rows)) return;
+
+    // CHA - cursor to an absolute column of the current row
+    std::cout << "\x1b[" << columns / 2 + 1 << 'G' << std::flush;
+}
+
+int Platform::readKey() {
+    if (!isatty(STDIN_FILENO)) {
+        const int c = std::cin.get();
+        return std::cin ? c : -1;
+    }
+
+    std::cout << std::flush;
+
+    termios original{};
+    if (tcgetattr(STDIN_FILENO, &original) != 0) return std::cin.get();
+
+    termios raw = original;
+    raw.c_lflag &= ~static_cast<tcflag_t>(ICANON | ECHO);
+    raw.c_cc[VMIN] = 1;
+    raw.c_cc[VTIME] = 0;
+    tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+
+    unsigned char key = 0;
+    ssize_t got;
+    do {
+        got = ::read(STDIN_FILENO, &key, 1);
+    } while (got < 0 && errno == EINTR);
+
+    tcsetattr(STDIN_FILENO, TCSANOW, &original);
+    return got == 1 ? key : -1;
+}
+
+size_t Platform::writeAll(int fd, const char* data, size_t size) {
+    size_t done = 0;
+
+    while (done < size) {
+        const ssize_t written = ::write(fd, data + done, size - done);
+        if (written < 0 && errno == EINTR) continue;
+        if (written <= 0) break;
+        done += static_cast<size_t>(written);
+    }
+
+    return done;
+}
+
+uint64_t Platform::processId() {
+    return static_cast<uint64_t>(getpid());
+}
+
+uint64_t Platform::threadId() {
+    // pthread_t is an integer on Linux and a pointer on macOS / BSD
+    const pthread_t self = pthread_self();
+    uint64_t id = 0;
+    std::copy_n(reinterpret_cast<const unsigned char*>(&self), std::min(sizeof(self), sizeof(id)),
+                reinterpret_cast<unsigned char*>(&id));
+    return id;
+}
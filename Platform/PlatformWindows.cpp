@@ -0,0 +1,107 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "Platform.h"
+
+#include <cstdio>
+#include <iostream>
+
+#include <windows.h>
+#include <conio.h>
+#include <io.h>
+#include <process.h>
+
+bool Platform::setupConsole() {
+    bool ok = enableAnsiColors();
+    if (!ok) {
+        std::cerr << "Warning: Failed to enable ANSI support\n";
+        // Continue execution - not critical
+    }
+
+    if (!SetConsoleOutputCP(CP_UTF8) || !SetConsoleCP(CP_UTF8)) {
+        std::cerr << "Warning: Failed to set UTF-8 encoding\n";
+        ok = false;
+    }
+
+    return ok;
+}
+
+bool Platform::enableAnsiColors() {
+    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    if (hOut == INVALID_HANDLE_VALUE) return false;
+
+    DWORD mode = 0;
+    if (!GetConsoleMode(hOut, &mode)) return false;
+    mode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+    return SetConsoleMode(hOut, mode) != 0;
+}
+
+bool Platform::terminalSize(int& columns, int& rows) {
+    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    if (hOut == INVALID_HANDLE_VALUE) return false;
+
+    CONSOLE_SCREEN_BUFFER_INFO csbi{};
+    if (!GetConsoleScreenBufferInfo(hOut, &csbi)) return false;
+
+    const int width = csbi.srWindow.Right - csbi.srWindow.Left + 1;
+    const int height = csbi.srWindow.Bottom - csbi.srWindow.Top + 1;
+    if (width > 0) columns = width;
+    if (height > 0) rows = height;
+    return width > 0;
+}
+
+bool Platform::watchTerminalResize(ResizeHandler) {
+    // The console has no resize signal; callers poll terminalSize()
+    return false;
+}
+
+void Platform::clearScreen() {
+    std::cout << "\x1b[H\x1b[2J\x1b[3J" << std::flush;
+}
+
+void Platform::moveCursorToCenterColumn() {
+    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    if (hOut == INVALID_HANDLE_VALUE) return;
+
+    CONSOLE_SCREEN_BUFFER_INFO csbi{};
+    if (!GetConsoleScreenBufferInfo(hOut, &csbi)) return;
+
+    int termWidth = csbi.srWindow.Right - csbi.srWindow.Left + 1;
+    if (termWidth <= 0) return;
+
+    std::cout << std::flush;
+    COORD pos = csbi.dwCursorPosition;
+    pos.X = static_cast<SHORT>(termWidth / 2);
+    SetConsoleCursorPosition(hOut, pos);
+}
+
+int Platform::readKey() {
+    if (!_isatty(_fileno(stdin))) {
+        const int c = std::cin.get();
+        return std::cin ? c : -1;
+    }
+
+    std::cout << std::flush;
+    return _getch();
+}
+
+size_t Platform::writeAll(int fd, const char* data, size_t size) {
+    size_t done = 0;
+
+    while (done < size) {
+        const int written = _write(fd, data + done, static_cast<unsigned>(size - done));
+        if (written <= 0) break;
+        done += static_cast<size_t>(written);
+    }
+
+    return done;
+}
+
+uint64_t Platform::processId() {
+    return static_cast<uint64_t>(_getpid());
+}
+
+uint64_t Platform::threadId() {
+    return static_cast<uint64_t>(GetCurrentThreadId());
+}
@@ -161,6 +161,23 @@ void Player::loseBet() {
     currentBet = 0;
 }
 
+void Player::settleBet(int payout) {
+    if (currentBet <= 0) {
+        throw std::logic_error("Player::settleBet: no active bet to settle");
+    }
+
+    if (payout < 0) {
+        throw std::invalid_argument(
+            "Player::settleBet: payout (" + std::to_string(payout) + ") must not be negative"
+        );
+    }
+
+    balance += payout;
+    winnings += payout - currentBet;
+
+    currentBet = 0;
+}
+
 void Player::cancelBet() {
     if (currentBet <= 0) {
         throw std::logic_error("Player::cancelBet: no active bet to cancel");
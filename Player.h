@@ -142,6 +142,14 @@ public:
      */
     void loseBet();
 
+    /**
+     * @brief Settles current bet with an exact payout
+     * @param payout Money paid back (0 if lost, stake included)
+     * @throws std::logic_error if no active bet
+     * @throws std::invalid_argument if payout < 0
+     */
+    void settleBet(int payout);
+
     /**
      * @brief Updates balance by amount
      * @param amount Amount to add (can be negative)
@@ -11,6 +11,7 @@
 
 #ifndef KASYNO_TEXTRES_H
 #define KASYNO_TEXTRES_H
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -24,6 +25,7 @@ namespace TextRes {
     // Main Menu
     constexpr const char* MAIN_MENU_TITLE = "CASINO MAIN MENU";  ///< Main menu title
     constexpr const char* LEADERBOARD_TITLE = "TOP 100 LEADERBOARD";  ///< Leaderboard title
+    constexpr size_t LEADERBOARD_TOP_COUNT = 100;                     ///< Players shown on the leaderboard
 
     const std::vector<std::string> MAIN_MENU_OPTIONS = {  ///< Main menu option texts
         "Create player",
@@ -84,10 +86,14 @@ namespace TextRes {
         "🍒", "🍋", "💎", "🌟", "🍀", "💰"
     };
 
+    const std::vector<std::string> SLOT_SYMBOL_NAMES = {  ///< Plain text slot symbol names (see SlotsIcon)
+        "Cherry", "Lemon", "Bell", "Star", "Clover", "Seven"
+    };
+
     // Roulette Game
     const std::vector<std::string> ROULETTE_GAME_OPTIONS = {  ///< Roulette game menu options
         "Spin the wheel",
-        "Change Bet",
+        "Change Bets",
         "View payouts",
         "Exit to Game Menu",
         "Exit"
@@ -103,9 +109,17 @@ namespace TextRes {
         "Odd",
         "Even",
         "Low (1-18)",
-        "High (19-36)"
+        "High (19-36)",
+        "Split (2 numbers)",
+        "Street (3 numbers)",
+        "Corner (4 numbers)",
+        "Six Line (6 numbers)",
+        "Dozen (12 numbers)",
+        "Column (12 numbers)"
     };
 
+    constexpr const char* ROULETTE_BET_SLIP_DONE = "Done - play these bets";  ///< Finishes the roulette bet slip
+
     // Blackjack Game
     constexpr const char* BLACKJACK_BET_OPTIONS_TITLE = "SELECT YOUR BLACKJACK BET";  ///< Blackjack bet selection title
 
@@ -6,13 +6,9 @@
 #include <stdexcept>
 #include <chrono>
 #include <cmath>
-#include <windows.h>
+#include <algorithm>
 
-#ifdef _WIN32
-    #include <process.h>
-#else
-    #include <unistd.h>
-#endif
+#include "Platform/Platform.h"
 
 uint64_t Rng::generateSeed() {
     uint64_t seed = 0;
@@ -31,13 +27,8 @@ uint64_t Rng::generateSeed() {
     ).count();
     seed ^= static_cast<uint64_t>(nanos);
 
-#ifdef _WIN32
-    seed ^= static_cast<uint64_t>(_getpid()) << 16;
-    seed ^= static_cast<uint64_t>(GetCurrentThreadId());
-#else
-    seed ^= static_cast<uint64_t>(getpid()) << 16;
-    seed ^= static_cast<uint64_t>(pthread_self());
-#endif
+    seed ^= Platform::processId() << 16;
+    seed ^= Platform::threadId();
 
     if (seed == 0) {
         seed = std::chrono::steady_clock::now().time_since_epoch().count();
@@ -46,16 +37,69 @@ uint64_t Rng::generateSeed() {
     return seed;
 }
 
-Rng::Rng() {
+Rng::Rng(): Rng(RngEngine::MT19937_64) {}
+
+Rng::Rng(RngEngine engine): engineType(engine) {
+    if (engineType == RngEngine::MT19937_64) {
+        mt = std::make_unique<std::mt19937_64>();
+    }
     reseed();
 }
 
+Rng::Rng(const Xoshiro256& state): engineType(RngEngine::XOSHIRO256), xoshiro(state) {}
+
+Rng Rng::forStream(uint64_t seed, uint64_t stream) {
+    Rng rng{Xoshiro256(seed)};
+    for (uint64_t i = 0; i < stream; ++i) {
+        rng.xoshiro.jump();
+    }
+    return rng;
+}
+
 void Rng::reseed() {
-    engine.seed(generateSeed());
+    reseed(generateSeed());
 }
 
 void Rng::reseed(uint64_t seed) {
-    engine.seed(seed);
+    if (engineType == RngEngine::XOSHIRO256) {
+        xoshiro.seed(seed);
+    } else {
+        mt->seed(seed);
+    }
+    drawn = 0;
+}
+
+void Rng::jump() {
+    if (engineType != RngEngine::XOSHIRO256) {
+        throw std::logic_error("Rng::jump: only supported by the XOSHIRO256 engine");
+    }
+    xoshiro.jump();
+}
+
+void Rng::longJump() {
+    if (engineType != RngEngine::XOSHIRO256) {
+        throw std::logic_error("Rng::longJump: only supported by the XOSHIRO256 engine");
+    }
+    xoshiro.longJump();
+}
+
+Rng Rng::split() {
+    if (engineType != RngEngine::XOSHIRO256) {
+        throw std::logic_error("Rng::split: only supported by the XOSHIRO256 engine");
+    }
+
+    Rng stream(xoshiro);
+    xoshiro.jump();
+    return stream;
+}
+
+void Rng::discard(uint64_t count) {
+    if (engineType == RngEngine::XOSHIRO256) {
+        xoshiro.discard(count);
+    } else {
+        mt->discard(count);
+    }
+    drawn += count;
 }
 
 int Rng::randInt(int min, int max) {
@@ -67,7 +111,106 @@ int Rng::randInt(int min, int max) {
     }
 
     std::uniform_int_distribution<int> dist(min, max);
-    return dist(engine);
+    return dist(*this);
+}
+
+void Rng::fillRaw(uint64_t* out, size_t count) {
+    if (engineType == RngEngine::XOSHIRO256) {
+        for (size_t i = 0; i < count; ++i) out[i] = xoshiro();
+    } else {
+        for (size_t i = 0; i < count; ++i) out[i] = (*mt)();
+    }
+    drawn += count;
+}
+
+void Rng::fillInt(std::span<int> out, int min, int max) {
+    if (min > max) {
+        throw std::invalid_argument(
+            "Rng::fillInt: min (" + std::to_string(min) +
+            ") cannot be greater than max (" + std::to_string(max) + ")"
+        );
+    }
+
+    constexpr size_t CHUNK = 256;
+    uint64_t raw[CHUNK];
+
+    const uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(max) - min) + 1;
+
+    if (range > std::numeric_limits<uint32_t>::max()) {
+        // Full int range, every 32-bit pattern is a valid value.
+        for (size_t base = 0; base < out.size(); base += CHUNK) {
+            const size_t count = std::min(CHUNK, out.size() - base);
+            fillRaw(raw, count);
+            for (size_t i = 0; i < count; ++i) {
+                out[base + i] = static_cast<int>(static_cast<uint32_t>(raw[i] >> 32));
+            }
+        }
+        return;
+    }
+
+    const uint32_t bound = static_cast<uint32_t>(range);
+    const uint32_t threshold = (0u - bound) % bound;
+    const int64_t offset = min;
+
+    for (size_t base = 0; base < out.size(); base += CHUNK) {
+        const size_t count = std::min(CHUNK, out.size() - base);
+        int* dst = out.data() + base;
+
+        fillRaw(raw, count);
+
+        uint32_t rejected = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const uint64_t m = (raw[i] >> 32) * bound;
+            dst[i] = static_cast<int>(offset + static_cast<int64_t>(m >> 32));
+            rejected |= static_cast<uint32_t>(static_cast<uint32_t>(m) < threshold);
+        }
+
+        if (rejected) {
+            for (size_t i = 0; i < count; ++i) {
+                uint64_t m = (raw[i] >> 32) * bound;
+                if (static_cast<uint32_t>(m) >= threshold) continue;
+
+                while (static_cast<uint32_t>(m) < threshold) {
+                    m = ((*this)() >> 32) * bound;
+                }
+                dst[i] = static_cast<int>(offset + static_cast<int64_t>(m >> 32));
+            }
+        }
+    }
+}
+
+void Rng::fillDouble(std::span<double> out, double min, double max) {
+    if (min > max) {
+        throw std::invalid_argument(
+            "Rng::fillDouble: min (" + std::to_string(min) +
+            ") cannot be greater than max (" + std::to_string(max) + ")"
+        );
+    }
+
+    if (std::isnan(min) || std::isnan(max)) {
+        throw std::invalid_argument("Rng::fillDouble: min and max cannot be NaN");
+    }
+
+    if (std::isinf(min) || std::isinf(max)) {
+        throw std::invalid_argument("Rng::fillDouble: min and max cannot be infinity");
+    }
+
+    constexpr size_t CHUNK = 256;
+    constexpr double TO_UNIT = 1.0 / 9007199254740992.0;  // 2^-53
+    uint64_t raw[CHUNK];
+
+    const double span = max - min;
+
+    for (size_t base = 0; base < out.size(); base += CHUNK) {
+        const size_t count = std::min(CHUNK, out.size() - base);
+        double* dst = out.data() + base;
+
+        fillRaw(raw, count);
+
+        for (size_t i = 0; i < count; ++i) {
+            dst[i] = min + span * (static_cast<double>(raw[i] >> 11) * TO_UNIT);
+        }
+    }
 }
 
 double Rng::randDouble(double min, double max) {
@@ -87,7 +230,7 @@ double Rng::randDouble(double min, double max) {
     }
 
     std::uniform_real_distribution<double> dist(min, max);
-    return dist(engine);
+    return dist(*this);
 }
 
 bool Rng::randBool(double probability) {
@@ -106,7 +249,7 @@ bool Rng::randBool(double probability) {
     if (probability >= 1.0) return true;
 
     std::uniform_real_distribution<double> dist(0.0, 1.0);
-    return dist(engine) < probability;
+    return dist(*this) < probability;
 }
 
 
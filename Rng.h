@@ -12,32 +12,91 @@
 #ifndef KASYNO_RNG_H
 #define KASYNO_RNG_H
 
+#include <cstdint>
+#include <limits>
+#include <memory>
 #include <random>
+#include <span>
+#include <stdexcept>
 
+#include "Xoshiro256.h"
+
+/**
+ * @enum RngEngine
+ * @brief Underlying generator used by Rng
+ */
+enum class RngEngine {
+    MT19937_64 = 0,  ///< Mersenne Twister 64-bit (2.5 KB state)
+    XOSHIRO256,      ///< xoshiro256** (32 B state, jump-ahead substreams)
+};
 
 /**
  * @class Rng
- * @brief Pseudo-random number generator using Mersenne Twister
+ * @brief Pseudo-random number generator with selectable engine
  *
  * Provides convenient methods for generating:
  * - Random integers in a range
  * - Random doubles in a range
  * - Random booleans with probability
+ *
+ * The interactive game uses Mersenne Twister. Simulators and servers use
+ * forStream(), which hands every worker a non-overlapping xoshiro256**
+ * substream of one master seed. Any draw can be reproduced from
+ * (seed, stream, position()).
  */
 class Rng {
-    std::mt19937_64 engine;  ///< Mersenne Twister 64-bit engine
+    RngEngine engineType;                  ///< Selected engine
+    std::unique_ptr<std::mt19937_64> mt;   ///< Mersenne Twister state (only for MT19937_64)
+    Xoshiro256 xoshiro;                    ///< xoshiro256** state (only for XOSHIRO256)
+    uint64_t drawn = 0;                    ///< Number of raw values drawn since last seeding
 
     /**
      * @brief Generates a high-quality seed from multiple sources
      * @return uint64_t Seed value
      */
     static uint64_t generateSeed();
+
+    /**
+     * @brief Fills a buffer with raw 64-bit values (engine selected once per call)
+     * @param out Output buffer
+     * @param count Number of values to generate
+     */
+    void fillRaw(uint64_t* out, size_t count);
+
+    /**
+     * @brief Constructor - wraps a xoshiro256** state without seeding
+     *
+     * Used by forStream() and split(), which set the state themselves;
+     * the public constructors would read std::random_device for nothing.
+     * @param state Generator state to start from
+     */
+    explicit Rng(const Xoshiro256& state);
 public:
+    using result_type = uint64_t;  ///< Type of raw generated values
+
     /**
-     * @brief Constructor - initializes RNG with random seed
+     * @brief Constructor - initializes Mersenne Twister RNG with random seed
      */
     Rng();
 
+    /**
+     * @brief Constructor - initializes selected engine with random seed
+     * @param engine Engine to use
+     */
+    explicit Rng(RngEngine engine);
+
+    /**
+     * @brief Creates a xoshiro256** generator positioned at a given substream
+     *
+     * Substream k starts 2^128 * k draws after the start of the seed,
+     * so streams of one seed never overlap.
+     *
+     * @param seed Master seed
+     * @param stream Substream index
+     * @return Rng Generator for the substream
+     */
+    static Rng forStream(uint64_t seed, uint64_t stream);
+
     /**
      * @brief Destructor
      */
@@ -72,6 +131,55 @@ public:
      */
     bool randBool(double probability);
 
+    /**
+     * @brief Generates a uniform integer in the range [0, bound)
+     *
+     * Uses Lemire's multiply-shift method: one 32x32 multiplication per value
+     * and a rejection step that is almost never taken, no division on the fast path.
+     *
+     * @param bound Exclusive upper bound (must be > 0)
+     * @return uint32_t Random integer in range
+     * @throws std::invalid_argument if bound is 0
+     */
+    uint32_t randBelow(uint32_t bound) {
+        if (bound == 0) {
+            throw std::invalid_argument("Rng::randBelow: bound cannot be 0");
+        }
+
+        uint64_t m = ((*this)() >> 32) * bound;
+        if (static_cast<uint32_t>(m) < bound) {
+            const uint32_t threshold = (0u - bound) % bound;
+            while (static_cast<uint32_t>(m) < threshold) {
+                m = ((*this)() >> 32) * bound;
+            }
+        }
+
+        return static_cast<uint32_t>(m >> 32);
+    }
+
+    /**
+     * @brief Fills a buffer with random integers in the range [min, max]
+     *
+     * Arguments are validated once per call. Values are mapped with a
+     * branch-free multiply-shift loop (auto-vectorized by the compiler),
+     * the rare rejected values are redrawn in a separate pass.
+     *
+     * @param out Output buffer
+     * @param min Minimum value (inclusive)
+     * @param max Maximum value (inclusive)
+     * @throws std::invalid_argument if min > max
+     */
+    void fillInt(std::span<int> out, int min, int max);
+
+    /**
+     * @brief Fills a buffer with random doubles in the range [min, max)
+     * @param out Output buffer
+     * @param min Minimum value (inclusive)
+     * @param max Maximum value (exclusive)
+     * @throws std::invalid_argument if min > max or bounds are NaN/infinite
+     */
+    void fillDouble(std::span<double> out, double min, double max);
+
     /**
      * @brief Reseeds the generator with new random value
      *
@@ -86,6 +194,59 @@ public:
      */
     void reseed(uint64_t seed);
 
+    /**
+     * @brief Moves xoshiro256** generator to its next substream (2^128 draws ahead)
+     * @throws std::logic_error if engine is not XOSHIRO256
+     */
+    void jump();
+
+    /**
+     * @brief Moves xoshiro256** generator 2^192 draws ahead
+     * @throws std::logic_error if engine is not XOSHIRO256
+     */
+    void longJump();
+
+    /**
+     * @brief Splits off the current substream
+     *
+     * The returned generator continues from the current state and this one
+     * jumps to its next substream, so each split is O(1) and the streams
+     * never overlap (unlike forStream, which jumps once per stream index).
+     *
+     * @return Rng Generator for the current substream
+     * @throws std::logic_error if engine is not XOSHIRO256
+     */
+    Rng split();
+
+    /**
+     * @brief Skips raw values, e.g. to replay a recorded position
+     * @param count Number of raw values to skip
+     */
+    void discard(uint64_t count);
+
+    /**
+     * @brief Number of raw values drawn since last seeding
+     * @return uint64_t Position in the current stream
+     */
+    uint64_t position() const { return drawn; }
+
+    /**
+     * @brief Gets the selected engine
+     * @return RngEngine Engine type
+     */
+    RngEngine engine() const { return engineType; }
+
+    /**
+     * @brief Generates next raw 64-bit value (UniformRandomBitGenerator interface)
+     * @return uint64_t Random value
+     */
+    uint64_t operator()() {
+        ++drawn;
+        return engineType == RngEngine::XOSHIRO256 ? xoshiro() : (*mt)();
+    }
+
+    static constexpr uint64_t min() { return 0; }
+    static constexpr uint64_t max() { return std::numeric_limits<uint64_t>::max(); }
 
 };
 
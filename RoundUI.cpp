@@ -4,36 +4,38 @@
 
 #include "RoundUI.h"
 
+#include <array>
 #include <iostream>
 #include <ostream>
 #include <algorithm>
 #include <limits>
-#include <unordered_map>
-#include <bits/this_thread_sleep.h>
+#include <string_view>
+#include <utility>
+#include <thread>
+#include "TerminalGeometry.h"
 #include "Games/RouletteTypes.h"
-
-#ifdef _WIN32
-    #include <windows.h>
-#else
-    #include <sys/ioctl.h>
-    #include <unistd.h>
-#endif
-
-static const std::unordered_map<std::string, std::string> ansiMap = {
-    {"reset", "0"},
-    {"bold", "1"},
-    {"black", "30"}, {"red", "31"},    {"green", "32"},
-    {"yellow","33"}, {"blue","34"},    {"magenta","35"},
-    {"cyan","36"},  {"white","37"},
-    // tła
-    {"bg_black","40"}, {"bg_red","41"}, {"bg_green","42"},
-    {"bg_yellow","43"},{"bg_blue","44"},{"bg_magenta","45"},
-    {"bg_cyan","46"},{"bg_white","47"}
-};
-
-static inline std::string ansi(const std::string& code) {
-    return "\x1b[" + code + "m";
-};
+#include "Platform/Platform.h"
+
+/**
+ * @brief Color names accepted by colorize()
+ */
+static constexpr std::array<std::pair<std::string_view, AnsiColor>, 8> COLOR_NAMES = {{
+    {"black", AnsiColor::BLACK}, {"red", AnsiColor::RED}, {"green", AnsiColor::GREEN},
+    {"yellow", AnsiColor::YELLOW}, {"blue", AnsiColor::BLUE}, {"magenta", AnsiColor::MAGENTA},
+    {"cyan", AnsiColor::CYAN}, {"white", AnsiColor::WHITE}
+}};
+
+/**
+ * @brief Looks up a color by name
+ * @param name Color name ("red", "white"...)
+ * @return AnsiColor Color, NONE for an unknown or empty name
+ */
+static constexpr AnsiColor colorByName(std::string_view name) {
+    for (const auto& [colorName, color] : COLOR_NAMES) {
+        if (colorName == name) return color;
+    }
+    return AnsiColor::NONE;
+}
 
 std::string RoundUI::trim(const std::string& str) {
     if (str.empty()) return "";
@@ -87,79 +89,28 @@ bool RoundUI::safeStringToInt(const std::string& str, int& value, int min, int m
     }
 }
 
-static bool enableAnsiColors() {
-#ifdef _WIN32
-    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
-    if (hOut == INVALID_HANDLE_VALUE) return false;
-    DWORD mode = 0;
-    if (!GetConsoleMode(hOut, &mode)) return false;
-    mode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
-    return SetConsoleMode(hOut, mode) != 0;
-#else
-    return true;
-#endif
-}
-
 std::string RoundUI::colorize(const std::string& text, const std::string& fg= "", const std::string& bg = "", bool bold = false) {
-    std::string seq;
+    const std::string_view sequence = FrameBuilder::style(colorByName(fg), colorByName(bg), bold);
+    if (sequence.empty()) return text;
 
-    if (bold) seq += ansiMap.at("bold") + ";";
-    if (!fg.empty() &&  ansiMap.count(fg)) seq += ansiMap.at(fg) + ";";
-    if (!bg.empty() && ansiMap.count("bg_" + bg)) seq += ansiMap.at("bg_" + bg) + ";";
-
-    if (!seq.empty()) {
-        if (seq.back() == ';') seq.pop_back();
-        return ansi(seq) + text + ansi(ansiMap.at("reset"));
-    }
-
-    return text;
+    std::string colored;
+    colored.reserve(sequence.size() + text.size() + FrameBuilder::RESET.size());
+    colored.append(sequence).append(text).append(FrameBuilder::RESET);
+    return colored;
 }
 
 int RoundUI::consoleWidth() const {
-#ifdef _WIN32
-    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
-    if (hOut == INVALID_HANDLE_VALUE) {
-        return 80;
-    }
-
-    CONSOLE_SCREEN_BUFFER_INFO csbi{};
-    if (GetConsoleScreenBufferInfo(hOut, &csbi)) {
-        int width = csbi.srWindow.Right - csbi.srWindow.Left + 1;
-        return (width > 0) ? width : 80;
-    }
-    return 80;
-#else
-    struct winsize w{};
-    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &w) == 0 && w.ws_col > 0) {
-        return w.ws_col;
-    }
-    return 80;
-#endif
+    return TerminalGeometry::columns();
 }
 
 void RoundUI::moveCursorToCenterRow() {
-#ifdef _WIN32
-    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
-    if (hOut == INVALID_HANDLE_VALUE) return;
-
-    CONSOLE_SCREEN_BUFFER_INFO csbi{};
-    if (!GetConsoleScreenBufferInfo(hOut, &csbi)) return;
-
-    int termWidth = csbi.srWindow.Right - csbi.srWindow.Left + 1;
-    if (termWidth <= 0) return;
-
-    SHORT targetCol = static_cast<SHORT>(termWidth / 2);
-
-    COORD pos = csbi.dwCursorPosition;
-    pos.X = targetCol;
-    SetConsoleCursorPosition(hOut, pos);
-#endif
+    Platform::moveCursorToCenterColumn();
 }
 
 std::string RoundUI::centerText(const std::string& text, int width) const {
     if (width <= 0) return text;
 
-    int displayLen = displayWidthUtf8(text);
+    int displayLen = TextWidth::measure(text);
     if (displayLen >= width) return text;
 
     int totalPadding = width - displayLen;
@@ -169,6 +120,33 @@ std::string RoundUI::centerText(const std::string& text, int width) const {
     return std::string(left, ' ') + text + std::string(right, ' ');
 }
 
+void RoundUI::beginLine(int lineWidth, int termWidth) const {
+    if (termWidth > 0 && lineWidth < termWidth) {
+        frame.repeat((termWidth - lineWidth) / 2);
+    }
+}
+
+void RoundUI::appendBoxLine(const BoxLine& line, int padLeft, int padRight, int termWidth) const {
+    beginLine(padLeft + line.width + padRight + 4, termWidth);
+    frame.append("| ");
+    frame.repeat(padLeft);
+    frame.append(line.text);
+    if (line.ellipsis) frame.append("...");
+    frame.repeat(padRight);
+    frame.append(" |\n");
+}
+
+void RoundUI::appendBorder(int innerWidth, int termWidth) const {
+    beginLine(innerWidth + 4, termWidth);
+    frame.append('+');
+    frame.repeat(innerWidth + 2, '-');
+    frame.append("+\n");
+}
+
+void RoundUI::commitLines() const {
+    if (!composing) frame.writeTo(outputFd);
+}
+
 void RoundUI::drawBox(const std::string& title,
                       const std::vector<std::string>& lines,
                       int padding) const {
@@ -180,65 +158,59 @@ void RoundUI::drawBox(const std::string& title,
     int maxContentWidth = width - 4;
     if (maxContentWidth < 20) maxContentWidth = 20;
 
+    // Long lines are cut to the screen, ending with "..." when there is room
     auto truncate = [this, maxContentWidth](const std::string& s) {
-        if (static_cast<int>(s.size()) <= maxContentWidth) return s;
-        if (maxContentWidth <= 3) return s.substr(0, maxContentWidth);
-        return s.substr(0, maxContentWidth - 3) + "...";
+        BoxLine shown{s, false, 0};
+        if (static_cast<int>(s.size()) > maxContentWidth) {
+            shown.ellipsis = maxContentWidth > 3;
+            shown.text = shown.text.substr(0, shown.ellipsis ? maxContentWidth - 3 : maxContentWidth);
+        }
+        shown.width = TextWidth::measure(shown.text) + (shown.ellipsis ? 3 : 0);
+        return shown;
     };
 
-    std::vector<std::string> content;
-    content.reserve(lines.size());
-    for (const auto& l : lines) content.push_back(truncate(l));
+    boxLines.clear();
+    for (const auto& l : lines) boxLines.push_back(truncate(l));
 
-    int boxWidth = displayWidthUtf8(truncate(title));
-    for (const auto& l : content)
-        boxWidth = std::max(boxWidth, displayWidthUtf8(l));
+    const BoxLine t = truncate(title);
+    int boxWidth = t.width;
+    for (const auto& l : boxLines)
+        boxWidth = std::max(boxWidth, l.width);
 
     boxWidth += padding * 2;
 
-    std::string horizontal(boxWidth + 2, '-');
-    std::string top    = "+" + horizontal + "+";
-    std::string middle = "+" + horizontal + "+";
-    std::string bottom = "+" + horizontal + "+";
-
-    int termWidth = consoleWidth();
-    auto centeredLine = [this, termWidth](const std::string& l) {
-        return centerText(l, termWidth);
-    };
-
-    std::cout << centeredLine(top) << "\n";
+    const int termWidth = consoleWidth();
+    appendBorder(boxWidth, termWidth);
 
     if (!title.empty()) {
-        std::string t = truncate(title);
-        int titleWidth = displayWidthUtf8(t);
-        int innerPaddingLeft  = (boxWidth - titleWidth) / 2;
-        int innerPaddingRight = boxWidth - titleWidth - innerPaddingLeft;
+        int innerPaddingLeft  = (boxWidth - t.width) / 2;
+        int innerPaddingRight = boxWidth - t.width - innerPaddingLeft;
         if (innerPaddingLeft  < 0) innerPaddingLeft  = 0;
         if (innerPaddingRight < 0) innerPaddingRight = 0;
 
-        std::string line =
-            "| " + std::string(innerPaddingLeft, ' ') + t +
-            std::string(innerPaddingRight, ' ') + " |";
-        std::cout << centeredLine(line) << "\n";
-        std::cout << centeredLine(middle) << "\n";
+        appendBoxLine(t, innerPaddingLeft, innerPaddingRight, termWidth);
+        appendBorder(boxWidth, termWidth);
     }
 
-    for (const auto& l : content) {
-        int lineWidth = displayWidthUtf8(l);
-        int spaces = boxWidth - lineWidth - padding;
+    for (const auto& l : boxLines) {
+        int spaces = boxWidth - l.width - padding;
         if (spaces < 0) spaces = 0;
 
-        std::string line =
-            "| " + std::string(padding, ' ') + l +
-            std::string(spaces, ' ') + " |";
-        std::cout << centeredLine(line) << "\n";
+        appendBoxLine(l, padding, spaces, termWidth);
     }
 
-    std::cout << centeredLine(bottom) << "\n";
+    appendBorder(boxWidth, termWidth);
+    commitLines();
 }
 
 void RoundUI::print(const std::string &text) const {
-    std::cout << centerText(text, consoleWidth()) << std::endl;
+    const int termWidth = consoleWidth();
+    const int textWidth = TextWidth::measure(text);
+
+    beginLine(textWidth, termWidth);
+    frame.append(text);
+    frame.append('\n');
+    commitLines();
 }
 
 int RoundUI::askChoice(const std::string &prompt, const std::vector<std::string>& options, bool clearScreen) const{
@@ -325,88 +297,32 @@ std::string RoundUI::ask(const std::string &prompt) const{
     }
 }
 
-int RoundUI::displayWidthUtf8(const std::string& s) const {
-    int width = 0;
-
-    for (std::size_t i = 0; i < s.size(); ) {
-        unsigned char c = static_cast<unsigned char>(s[i]);
-
-        if (c < 0x80) {
-            width += 1;
-            ++i;
-            continue;
-        }
-
-        uint32_t cp = 0;
-        std::size_t len = 0;
-
-        if ((c & 0xE0) == 0xC0 && i + 1 < s.size()) {
-            cp = (c & 0x1F) << 6 |
-                 (static_cast<unsigned char>(s[i+1]) & 0x3F);
-            len = 2;
-        } else if ((c & 0xF0) == 0xE0 && i + 2 < s.size()) {
-            cp = (c & 0x0F) << 12 |
-                 (static_cast<unsigned char>(s[i+1]) & 0x3F) << 6 |
-                 (static_cast<unsigned char>(s[i+2]) & 0x3F);
-            len = 3;
-        } else if ((c & 0xF8) == 0xF0 && i + 3 < s.size()) {
-            cp = (c & 0x07) << 18 |
-                 (static_cast<unsigned char>(s[i+1]) & 0x3F) << 12 |
-                 (static_cast<unsigned char>(s[i+2]) & 0x3F) << 6 |
-                 (static_cast<unsigned char>(s[i+3]) & 0x3F);
-            len = 4;
-        } else {
-            ++i;
-            continue;
-        }
-
-        if (cp == 0xFE0F || cp == 0x200D) {
-            i += len;
-            continue;
-        }
-
-        if ( (cp >= 0x1F300 && cp <= 0x1FAFF) ||
-             (cp >= 0x2600 && cp <= 0x26FF) ||
-             (cp >= 0x2700 && cp <= 0x27BF) ||
-             cp == 0x2B50
-           ) {
-            width += 2;
-           } else {
-               width += 1;
-           }
-
-        i += len;
+void RoundUI::renderSlots(const std::vector<std::string>& symbols) {
+    slotTexts.resize(symbols.size());
+    for (size_t i = 0; i < symbols.size(); ++i) {
+        slotTexts[i].text = symbols[i];
+        slotTexts[i].width = TextWidth::measure(symbols[i]);
     }
 
-    return width;
+    renderSlots(slotTexts);
 }
 
-
-void RoundUI::renderSlots(const std::vector<std::string>& symbols) {
+void RoundUI::renderSlots(const std::vector<MeasuredText>& symbols) {
     if (symbols.empty()) {
         std::cerr << "Error: Symbols vector is empty\n";
         return;
     }
 
-    clear();
+    if (!composing) clear();
 
     int termWidth = consoleWidth();
     if (termWidth < 20) termWidth = 80;
 
     const int innerWidth = 25;
 
-    std::string horizontal(innerWidth + 2, '-');
-    std::string top    = "+" + horizontal + "+";
-    std::string middle = "+" + horizontal + "+";
-    std::string bottom = "+" + horizontal + "+";
-
-    auto centeredLine = [this, termWidth](const std::string& l) {
-        return centerText(l, termWidth);
-    };
+    appendBorder(innerWidth, termWidth);
 
-    std::cout << centeredLine(top) << "\n";
-
-    const std::string title = "=== SLOTS GAME ===";
+    const std::string_view title = "=== SLOTS GAME ===";
     int titleLen = static_cast<int>(title.size());
 
     int padLeftTitle  = (innerWidth - titleLen) / 2;
@@ -414,20 +330,12 @@ void RoundUI::renderSlots(const std::vector<std::string>& symbols) {
     if (padLeftTitle  < 0) padLeftTitle  = 0;
     if (padRightTitle < 0) padRightTitle = 0;
 
-    std::cout << centeredLine(
-        "| " + std::string(padLeftTitle, ' ') + title +
-        std::string(padRightTitle, ' ') + " |"
-    ) << "\n";
-
-    std::cout << centeredLine(middle) << "\n";
+    appendBoxLine(BoxLine{title, false, titleLen}, padLeftTitle, padRightTitle, termWidth);
+    appendBorder(innerWidth, termWidth);
 
-    std::string row;
-    for (std::size_t i = 0; i < symbols.size(); ++i) {
-        row += symbols[i];
-        if (i + 1 < symbols.size()) row += "  ";
-    }
-
-    int rowDisplayWidth = displayWidthUtf8(row);
+    // Symbols are separated by two spaces
+    int rowDisplayWidth = 2 * static_cast<int>(symbols.size() - 1);
+    for (const MeasuredText& symbol : symbols) rowDisplayWidth += symbol.width;
 
     int padTotal = innerWidth - rowDisplayWidth;
     if (padTotal < 0) padTotal = 0;
@@ -435,12 +343,18 @@ void RoundUI::renderSlots(const std::vector<std::string>& symbols) {
     int padLeftRow  = padTotal / 2;
     int padRightRow = padTotal - padLeftRow;
 
-    std::cout << centeredLine(
-        "| " + std::string(padLeftRow, ' ') + row +
-        std::string(padRightRow, ' ') + " |"
-    ) << "\n";
+    beginLine(padLeftRow + rowDisplayWidth + padRightRow + 4, termWidth);
+    frame.append("| ");
+    frame.repeat(padLeftRow);
+    for (std::size_t i = 0; i < symbols.size(); ++i) {
+        frame.append(symbols[i].text);
+        if (i + 1 < symbols.size()) frame.append("  ");
+    }
+    frame.repeat(padRightRow);
+    frame.append(" |\n");
 
-    std::cout << centeredLine(bottom) << "\n";
+    appendBorder(innerWidth, termWidth);
+    commitLines();
 }
 
 void RoundUI::renderWheel(const std::vector<RouletteTile>& wheel, const int& spunTile) {
@@ -454,97 +368,94 @@ void RoundUI::renderWheel(const std::vector<RouletteTile>& wheel, const int& spu
         return;
     }
 
-    enableAnsiColors();
-    clear();
+    static const bool ansiEnabled = Platform::enableAnsiColors();
+    (void)ansiEnabled;
+
+    if (!composing) clear();
 
     int termWidth = consoleWidth();
     if (termWidth < 40) termWidth = 80;
 
     int n = static_cast<int>(wheel.size());
 
-    std::string row;
+    // Nine tiles of " nn " separated by spaces, the center one between "><"
+    const int visibleTiles = 9;
+    const int rowWidth = visibleTiles * 4 + (visibleTiles - 1) + 2;
+
+    const std::string_view pointer = "▼";
+    const int pointerWidth = 1;
+
+    int innerWidth = std::max(rowWidth, pointerWidth);
+
+    int boxWidth = innerWidth + 4;
+    int leftPad  = std::max(0, (termWidth - boxWidth) / 2);
+
+    auto border = [&] {
+        frame.repeat(leftPad);
+        frame.append('+');
+        frame.repeat(innerWidth + 2, '-');
+        frame.append("+\n");
+    };
+    auto boxLine = [&](std::string_view text, int textWidth) {
+        int spaces = std::max(0, innerWidth - textWidth);
+        frame.repeat(leftPad);
+        frame.append("| ");
+        frame.repeat(spaces / 2);
+        frame.append(text);
+        frame.repeat(spaces - spaces / 2);
+        frame.append(" |\n");
+    };
+
+    const std::string_view title = " ROULETTE WHEEL ";
+
+    border();
+    boxLine(title, static_cast<int>(title.size()));
+    border();
+    boxLine(pointer, pointerWidth);
+
+    int rowSpaces = std::max(0, innerWidth - rowWidth);
+    frame.repeat(leftPad);
+    frame.append("| ");
+    frame.repeat(rowSpaces / 2);
 
     for (int offset = -4; offset <= 4; ++offset) {
         int idx = (spunTile + offset + n) % n;
         const auto& tile = wheel[idx];
         bool isCenter = (offset == 0);
 
-        std::string num = std::to_string(tile.number);
-        if (num.size() == 1) num = " " + num;
+        const char label[4] = {
+            ' ',
+            tile.number >= 10 ? static_cast<char>('0' + tile.number / 10) : ' ',
+            static_cast<char>('0' + tile.number % 10),
+            ' '
+        };
 
-        std::string colored;
+        AnsiColor fg = AnsiColor::WHITE;
+        AnsiColor bg = AnsiColor::BLACK;
         if (tile.color == RouletteTileType::RED) {
-            colored = colorize(" " + num + " ", "white", "red", isCenter);
-        } else if (tile.color == RouletteTileType::BLACK) {
-            colored = colorize(" " + num + " ", "white", "black", isCenter);
-        } else {
-            colored = colorize(" " + num + " ", "black", "green", isCenter);
+            bg = AnsiColor::RED;
+        } else if (tile.color == RouletteTileType::GREEN) {
+            fg = AnsiColor::BLACK;
+            bg = AnsiColor::GREEN;
         }
 
-        if (isCenter) {
-            colored = ">" + colored + "<";
-        }
-
-        if (!row.empty()) row += " ";
-        row += colored;
+        if (offset != -4) frame.append(' ');
+        if (isCenter) frame.append('>');
+        frame.appendStyled(std::string_view(label, 4), fg, bg, isCenter);
+        if (isCenter) frame.append('<');
     }
 
-    std::string pointer = "▼";
-    std::string rowPlain = stripAnsi(row);
-
-    int innerWidth = std::max(
-        displayWidthUtf8(rowPlain),
-        displayWidthUtf8(pointer)
-    );
+    frame.repeat(rowSpaces - rowSpaces / 2);
+    frame.append(" |\n");
 
-    int boxWidth = innerWidth + 4;
-    int leftPad  = std::max(0, (termWidth - boxWidth) / 2);
-    std::string indent(leftPad, ' ');
-
-    std::string top    = "+" + std::string(innerWidth + 2, '-') + "+";
-    std::string bottom = top;
-
-    // pointer line
-    int ptrW = displayWidthUtf8(pointer);
-    int ptrSpaces = std::max(0, innerWidth - ptrW);
-    int ptrLeft  = ptrSpaces / 2;
-    int ptrRight = ptrSpaces - ptrLeft;
-
-    std::string pointerLine =
-        "| " + std::string(ptrLeft, ' ') + pointer +
-        std::string(ptrRight, ' ') + " |";
-
-    int rowW = displayWidthUtf8(rowPlain);
-    int rowSpaces = std::max(0, innerWidth - rowW);
-    int rowLeft  = rowSpaces / 2;
-    int rowRight = rowSpaces - rowLeft;
-
-    std::string rowLine =
-        "| " + std::string(rowLeft, ' ') + row +
-        std::string(rowRight, ' ') + " |";
-
-    std::string title = " ROULETTE WHEEL ";
-    int titleW = displayWidthUtf8(title);
-    int titleSpaces = std::max(0, innerWidth - titleW);
-    int titleLeft = titleSpaces / 2;
-    int titleRight = titleSpaces - titleLeft;
-
-    std::string titleLine =
-        "| " + std::string(titleLeft, ' ') + title +
-        std::string(titleRight, ' ') + " |";
-
-    std::cout << indent << top        << "\n";
-    std::cout << indent << titleLine  << "\n";
-    std::cout << indent << top        << "\n";
-    std::cout << indent << pointerLine<< "\n";
-    std::cout << indent << rowLine    << "\n";
-    std::cout << indent << bottom     << "\n";
+    border();
+    commitLines();
 }
 
 std::string RoundUI::centerColored(const std::string& s, int termWidth) const {
     if (termWidth <= 0) return s;
 
-    int realWidth = displayWidthUtf8(stripAnsi(s));
+    int realWidth = TextWidth::measureVisible(s);
     if (realWidth >= termWidth) return s;
 
     int padding = (termWidth - realWidth) / 2;
@@ -580,14 +491,37 @@ void RoundUI::pause(const int ms) {
 }
 
 void RoundUI::clear() {
-#ifdef _WIN32
-    system("cls");
-#else
-    system("clear");
-#endif
+    Platform::clearScreen();
+    ++clearCount;
+}
+
+void RoundUI::beginFrame() {
+    frame.clear();
+    composing = true;
+}
+
+void RoundUI::presentFrame() {
+    composing = false;
+
+    // Whatever the last frame left on the screen is gone after a clear,
+    // and a resized terminal reflows it and centers the frame elsewhere
+    const uint64_t geometryVersion = TerminalGeometry::version();
+    if (frameClearCount != clearCount || frameGeometryVersion != geometryVersion) {
+        screen.invalidate();
+        frameClearCount = clearCount;
+        frameGeometryVersion = geometryVersion;
+    }
+
+    screen.diff(frame.view(), output);
+    frame.clear();
+    output.writeTo(outputFd);
+}
+
+uint64_t RoundUI::getBytesWritten() const {
+    return frame.getTotalWritten() + output.getTotalWritten();
 }
 
-void RoundUI::leaderboard(const std::string& title, const std::vector<LeaderboardEntry>& entries) {
+void RoundUI::leaderboard(const std::string& title, const std::vector<LeaderboardEntry>& entries, size_t firstRank) {
     std::vector<std::string> lines;
 
     if (entries.empty()) {
@@ -596,7 +530,7 @@ void RoundUI::leaderboard(const std::string& title, const std::vector<Leaderboar
         lines.emplace_back("");
     } else {
         for (size_t i = 0; i < entries.size(); ++i) {
-            std::string rank = std::to_string(i + 1) + ".";
+            std::string rank = std::to_string(firstRank + i) + ".";
             std::string name = entries[i].name;
             std::string balance = std::to_string(entries[i].balance) + "$";
 
@@ -610,7 +544,7 @@ void RoundUI::leaderboard(const std::string& title, const std::vector<Leaderboar
 
 void RoundUI::waitForKey(const std::string& message) const {
     print(message);
-    std::cin.get();
+    Platform::readKey();
 }
 
 void RoundUI::waitForEnter(const std::string& message) const {
@@ -11,10 +11,15 @@
 
 #ifndef KASYNO_ROUNDUI_H
 #define KASYNO_ROUNDUI_H
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "FileHandler.h"
+#include "FrameBuilder.h"
+#include "ScreenBuffer.h"
+#include "TextWidth.h"
 #include "Games/RouletteTypes.h"
 
 /**
@@ -27,8 +32,64 @@
  * - Getting user input
  * - Rendering game-specific interfaces (slots, roulette wheel)
  * - Displaying leaderboards
+ *
+ * Boxes are composed in a reusable byte arena (FrameBuilder) and written
+ * with a single write() call. Between beginFrame() and presentFrame()
+ * nothing is printed; the lines are collected into a frame and only the
+ * cells that differ from the previous frame are written. Animations use
+ * this so the screen is never cleared and redrawn from scratch.
  */
 class RoundUI {
+    static inline uint64_t clearCount = 0;  ///< Number of times the screen was cleared
+
+    /**
+     * @struct BoxLine
+     * @brief Box content line, cut to fit the screen
+     */
+    struct BoxLine {
+        std::string_view text;  ///< Shown part of the line
+        bool ellipsis;          ///< Whether "..." follows the text
+        int width;              ///< Display width including the "..."
+    };
+
+    int outputFd = 1;                              ///< Descriptor frames are written to
+    mutable FrameBuilder frame;                    ///< Lines being drawn (the whole frame while composing)
+    mutable FrameBuilder output;                   ///< Frame updates for the terminal
+    mutable ScreenBuffer screen;                   ///< Cells currently on the screen
+    mutable std::vector<BoxLine> boxLines;         ///< drawBox() scratch space
+    std::vector<MeasuredText> slotTexts;           ///< renderSlots() scratch space
+    mutable bool composing = false;                ///< Between beginFrame() and presentFrame()
+    uint64_t frameClearCount = 0;                  ///< clearCount when the last frame was shown
+    uint64_t frameGeometryVersion = 0;             ///< Terminal size version when the last frame was shown
+
+    /**
+     * @brief Appends the padding that centers a line
+     * @param lineWidth Display width of the line
+     * @param termWidth Terminal width
+     */
+    void beginLine(int lineWidth, int termWidth) const;
+
+    /**
+     * @brief Appends a centered "| text |" line
+     * @param line Text
+     * @param padLeft Spaces before the text
+     * @param padRight Spaces after the text
+     * @param termWidth Terminal width
+     */
+    void appendBoxLine(const BoxLine& line, int padLeft, int padRight, int termWidth) const;
+
+    /**
+     * @brief Appends a centered "+---+" border
+     * @param innerWidth Width between "| " and " |"
+     * @param termWidth Terminal width
+     */
+    void appendBorder(int innerWidth, int termWidth) const;
+
+    /**
+     * @brief Writes the drawn lines in one call, unless a frame is being composed
+     */
+    void commitLines() const;
+
     /**
      * @brief Trims whitespace from a string
      * @param str String to trim
@@ -37,7 +98,7 @@ class RoundUI {
     static std::string trim(const std::string& str);
 
     /**
-     * @brief Gets the current console width
+     * @brief Gets the current console width (cached, see TerminalGeometry)
      * @return int Console width in characters
      */
     int consoleWidth() const;
@@ -80,13 +141,6 @@ class RoundUI {
      */
     std::string stripAnsi(const std::string& s) const;
 
-    /**
-     * @brief Calculates display width of UTF-8 string
-     * @param str UTF-8 encoded string
-     * @return int Display width in characters
-     */
-    int displayWidthUtf8(const std::string& str) const;
-
     /**
      * @brief Validates if string is a valid integer
      * @param str String to validate
@@ -109,6 +163,12 @@ public:
      */
     RoundUI() = default;
 
+    /**
+     * @brief Constructor - draws to another descriptor (benchmarks, redirected output)
+     * @param outputFd File descriptor boxes and frames are written to
+     */
+    explicit RoundUI(int outputFd): outputFd(outputFd) {}
+
     /**
      * @brief Destructor
      */
@@ -183,6 +243,12 @@ public:
      */
     void renderSlots(const std::vector<std::string>& symbols);
 
+    /**
+     * @brief Renders slot machine reels from symbols measured in advance
+     * @param symbols Symbols with their display widths
+     */
+    void renderSlots(const std::vector<MeasuredText>& symbols);
+
     /**
      * @brief Renders roulette wheel with highlighted result
      * @param wheel Vector of roulette tiles
@@ -190,6 +256,22 @@ public:
      */
     void renderWheel(const std::vector<RouletteTile>& wheel, const int &spunTile);
 
+    /**
+     * @brief Starts composing a frame instead of printing
+     */
+    void beginFrame();
+
+    /**
+     * @brief Shows the composed frame, writing only what changed since the last one
+     */
+    void presentFrame();
+
+    /**
+     * @brief Gets the number of bytes drawn so far
+     * @return uint64_t Bytes written by boxes and frames
+     */
+    uint64_t getBytesWritten() const;
+
     /**
      * @brief Pauses execution for specified milliseconds
      * @param ms Milliseconds to pause
@@ -197,7 +279,7 @@ public:
     static void pause(int ms);
 
     /**
-     * @brief Clears the console screen
+     * @brief Clears the console screen (ANSI sequence, no shell command)
      */
     static void clear();
 
@@ -205,8 +287,9 @@ public:
      * @brief Displays leaderboard with entries
      * @param title Leaderboard title
      * @param entries Vector of leaderboard entries to display
+     * @param firstRank Place of the first entry (1 for the top of the leaderboard)
      */
-    void leaderboard(const std::string& title, const std::vector<LeaderboardEntry>& entries);
+    void leaderboard(const std::string& title, const std::vector<LeaderboardEntry>& entries, size_t firstRank = 1);
 };
 
 
@@ -0,0 +1,196 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "ScreenBuffer.h"
+
+/**
+ * @brief Appends a cursor move to an absolute position
+ * @param out Output bytes
+ * @param row 0-based screen row
+ * @param col 0-based screen column
+ */
+static void moveCursor(FrameBuilder& out, size_t row, size_t col) {
+    out.append("\x1b[");
+    out.appendNumber(static_cast<int64_t>(row + 1));
+    out.append(';');
+    out.appendNumber(static_cast<int64_t>(col + 1));
+    out.append('H');
+}
+
+/**
+ * @brief Appends the SGR sequence that switches to a style
+ * @param out Output bytes
+ * @param style SGR parameters ("" = default colors)
+ */
+static void setStyle(FrameBuilder& out, const std::string& style) {
+    out.append("\x1b[0");
+    if (!style.empty()) {
+        out.append(';');
+        out.append(style);
+    }
+    out.append('m');
+}
+
+int ScreenBuffer::codepointWidth(uint32_t cp) {
+    if (cp == 0xFE0F || cp == 0x200D) return 0;
+
+    if ((cp >= 0x1F300 && cp <= 0x1FAFF) ||
+        (cp >= 0x2600 && cp <= 0x26FF) ||
+        (cp >= 0x2700 && cp <= 0x27BF) ||
+        cp == 0x2B50) {
+        return 2;
+    }
+
+    return 1;
+}
+
+uint32_t ScreenBuffer::decodeUtf8(std::string_view s, size_t& i) {
+    const auto byte = [&s](size_t k) { return static_cast<unsigned char>(s[k]); };
+    const unsigned char c = byte(i);
+
+    if (c < 0x80) {
+        ++i;
+        return c;
+    }
+
+    uint32_t cp;
+    if ((c & 0xE0) == 0xC0 && i + 1 < s.size()) {
+        cp = (c & 0x1F) << 6 | (byte(i + 1) & 0x3F);
+        i += 2;
+    } else if ((c & 0xF0) == 0xE0 && i + 2 < s.size()) {
+        cp = (c & 0x0F) << 12 | (byte(i + 1) & 0x3F) << 6 | (byte(i + 2) & 0x3F);
+        i += 3;
+    } else if ((c & 0xF8) == 0xF0 && i + 3 < s.size()) {
+        cp = (c & 0x07) << 18 | (byte(i + 1) & 0x3F) << 12 | (byte(i + 2) & 0x3F) << 6 | (byte(i + 3) & 0x3F);
+        i += 4;
+    } else {
+        cp = 0xFFFD;
+        ++i;
+    }
+
+    return cp;
+}
+
+void ScreenBuffer::parseLine(std::string_view line, std::vector<Cell>& cells) {
+    cells.clear();
+
+    std::string style;
+    for (size_t i = 0; i < line.size(); ) {
+        // SGR sequence: a leading "0" resets, anything else adds to the style
+        if (line[i] == '\x1b' && i + 1 < line.size() && line[i + 1] == '[') {
+            const size_t end = line.find('m', i + 2);
+            if (end == std::string_view::npos) break;
+
+            const std::string_view params = line.substr(i + 2, end - i - 2);
+            if (params.empty() || params == "0") {
+                style.clear();
+            } else if (params.starts_with("0;")) {
+                style.assign(params.substr(2));
+            } else {
+                if (!style.empty()) style += ';';
+                style += params;
+            }
+
+            i = end + 1;
+            continue;
+        }
+
+        const size_t start = i;
+        const int width = codepointWidth(decodeUtf8(line, i));
+
+        // Joiners and variation selectors belong to the glyph before them
+        if (width == 0) {
+            if (!cells.empty()) {
+                Cell& owner = cells.back().width == 0 ? cells[cells.size() - 2] : cells.back();
+                owner.glyph.append(line, start, i - start);
+            }
+            continue;
+        }
+
+        cells.push_back(Cell{std::string(line.substr(start, i - start)), style, static_cast<uint8_t>(width)});
+        if (width == 2) cells.push_back(Cell{"", style, 0});
+    }
+}
+
+void ScreenBuffer::diff(std::string_view frame, FrameBuilder& out) {
+    // Rows are parsed into the buffers of an older frame, so a steady
+    // animation does not allocate
+    size_t rows = 0;
+    for (size_t start = 0; start < frame.size(); ++rows) {
+        size_t end = frame.find('\n', start);
+        if (end == std::string_view::npos) end = frame.size();
+
+        if (next.size() <= rows) next.emplace_back();
+        parseLine(frame.substr(start, end - start), next[rows]);
+        start = end + 1;
+    }
+
+    if (!valid) {
+        out.append("\x1b[0m\x1b[H\x1b[2J");
+        previousRows = 0;
+    }
+
+    std::string current;          // Style the terminal is drawing with
+    bool cursorKnown = false;     // Whether the cursor is at (cursorRow, cursorCol)
+    size_t cursorRow = 0, cursorCol = 0;
+    static const std::vector<Cell> EMPTY_ROW;
+
+    for (size_t row = 0; row < rows; ++row) {
+        const std::vector<Cell>& cells = next[row];
+        const std::vector<Cell>& old = row < previousRows ? previous[row] : EMPTY_ROW;
+
+        for (size_t col = 0; col < cells.size(); ++col) {
+            const Cell& cell = cells[col];
+            if (cell.width == 0 || (col < old.size() && old[col] == cell)) continue;
+
+            if (!cursorKnown || cursorRow != row || cursorCol != col) moveCursor(out, row, col);
+            if (cell.style != current) {
+                setStyle(out, cell.style);
+                current = cell.style;
+            }
+
+            out.append(cell.glyph);
+            cursorRow = row;
+            cursorCol = col + cell.width;
+
+            // Terminals disagree on the width of some emoji, so do not
+            // trust the cursor position after anything but ASCII
+            cursorKnown = cell.glyph.size() == 1;
+        }
+
+        // The old line was longer: erase what is left of it
+        if (old.size() > cells.size()) {
+            moveCursor(out, row, cells.size());
+            if (!current.empty()) {
+                setStyle(out, "");
+                current.clear();
+            }
+            out.append("\x1b[K");
+            cursorKnown = false;
+        }
+    }
+
+    // Erase rows the new frame no longer uses
+    for (size_t row = rows; row < previousRows; ++row) {
+        if (previous[row].empty()) continue;
+
+        moveCursor(out, row, 0);
+        if (!current.empty()) {
+            setStyle(out, "");
+            current.clear();
+        }
+        out.append("\x1b[K");
+    }
+
+    if (!current.empty()) out.append(FrameBuilder::RESET);
+    moveCursor(out, rows, 0);
+
+    std::swap(previous, next);
+    previousRows = rows;
+    valid = true;
+}
+
+void ScreenBuffer::invalidate() {
+    valid = false;
+}
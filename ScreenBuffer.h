@@ -0,0 +1,98 @@
+/**
+ * @file ScreenBuffer.h
+ * @brief Double-buffered terminal frames that redraw only changed cells
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_SCREENBUFFER_H
+#define KASYNO_SCREENBUFFER_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "FrameBuilder.h"
+
+/**
+ * @class ScreenBuffer
+ * @brief Keeps the last frame shown and turns the next one into a minimal update
+ *
+ * A frame is a list of text lines that may contain UTF-8 and ANSI color
+ * codes (SGR, "\x1b[...m"). Each line is split into cells: one glyph,
+ * the color it is drawn with and its display width (wide emoji take a
+ * cell plus a continuation cell). diff() compares the cells with the
+ * previous frame and returns cursor moves, colors and glyphs for the
+ * changed cells only.
+ *
+ * Frames are drawn from the top-left corner of the screen.
+ */
+class ScreenBuffer {
+public:
+    /**
+     * @struct Cell
+     * @brief One terminal column of a frame
+     */
+    struct Cell {
+        std::string glyph;   ///< UTF-8 bytes (empty for the second column of a wide glyph)
+        std::string style;   ///< SGR parameters active for the glyph ("" = default colors)
+        uint8_t width = 1;   ///< Display width (0 for the second column of a wide glyph)
+
+        bool operator==(const Cell&) const = default;
+    };
+
+private:
+    std::vector<std::vector<Cell>> previous;  ///< Cells currently on the screen
+    std::vector<std::vector<Cell>> next;      ///< Cells of the frame being diffed (reused)
+    size_t previousRows = 0;                  ///< Rows of previous in use
+    bool valid = false;                       ///< Whether the screen still shows previous
+
+public:
+    /**
+     * @brief Gets the display width of a code point
+     * @param cp Unicode code point
+     * @return int 0 for joiners and variation selectors, 2 for emoji, 1 otherwise
+     */
+    static int codepointWidth(uint32_t cp);
+
+    /**
+     * @brief Decodes one UTF-8 code point
+     * @param s String
+     * @param i Position of the first byte; advanced past the code point
+     * @return uint32_t Code point (U+FFFD for a malformed sequence, which consumes one byte)
+     */
+    static uint32_t decodeUtf8(std::string_view s, size_t& i);
+
+    /**
+     * @brief Splits a line into cells
+     * @param line Text with UTF-8 and ANSI color codes
+     * @param cells Output, one cell per display column (capacity is reused)
+     */
+    static void parseLine(std::string_view line, std::vector<Cell>& cells);
+
+    /**
+     * @brief Appends the bytes that turn the screen into a new frame
+     *
+     * The first frame (and the first after invalidate()) clears the
+     * screen and draws everything. Leaves the cursor on the line below
+     * the frame with default colors.
+     *
+     * @param frame New frame, one screen row per '\n'-terminated line
+     * @param out Output the update is appended to
+     */
+    void diff(std::string_view frame, FrameBuilder& out);
+
+    /**
+     * @brief Forgets the screen contents, so the next frame is drawn in full
+     *
+     * Call it when something else has written over or cleared the screen.
+     */
+    void invalidate();
+};
+
+#endif //KASYNO_SCREENBUFFER_H
@@ -0,0 +1,395 @@
+/**
+ * @file LoadGenMain.cpp
+ * @brief Entry point of kasyno_loadgen, a local load generator for kasyno_server
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "../CommandLine.h"
+
+#ifdef MSG_NOSIGNAL
+static constexpr int SEND_FLAGS = MSG_NOSIGNAL;  ///< A closed server must not raise SIGPIPE
+#else
+static constexpr int SEND_FLAGS = 0;
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @struct LoadConfig
+ * @brief Load generator options
+ */
+struct LoadConfig {
+    std::string socketPath = "kasyno.sock";  ///< Server socket
+    size_t clients = 100;                    ///< Connections
+    size_t sessions = 10;                    ///< Sessions (tables) per connection
+    uint64_t rounds = 100;                   ///< Rounds per session
+    std::string game = "mixed";              ///< slots, roulette, blackjack or mixed
+    int stake = 10;                          ///< Stake of every round
+    int balance = 1000000;                   ///< Starting balance of every session
+};
+
+/**
+ * @struct LoadClient
+ * @brief One connection driving its sessions, one request in flight per session
+ */
+struct LoadClient {
+    int fd = -1;                                      ///< Socket
+    std::string input;                                ///< Received bytes not yet split into lines
+    std::string output;                               ///< Request bytes not yet sent
+    size_t written = 0;                               ///< Bytes of output already sent
+    std::unordered_map<uint64_t, size_t> slots;       ///< Session id -> index
+    std::vector<uint64_t> remaining;                  ///< Rounds left per session
+    std::vector<Clock::time_point> sentAt;            ///< When the pending request was sent
+    size_t finished = 0;                              ///< Sessions closed (or failed to open)
+};
+
+/**
+ * @struct LoadStats
+ * @brief Results of a run
+ */
+struct LoadStats {
+    uint64_t rounds = 0;             ///< Rounds answered with OK
+    uint64_t errors = 0;             ///< Requests answered with ERR
+    int64_t staked = 0;              ///< Money staked in all rounds
+    int64_t paid = 0;                ///< Money paid back in all rounds
+    std::vector<uint64_t> latencies; ///< Round-trip time of every round (ns)
+};
+
+/**
+ * @brief Prints command line usage
+ */
+static void printUsage() {
+    std::cout <<
+        "Usage: kasyno_loadgen [options]\n"
+        "\n"
+        "Opens many sessions on a running kasyno_server and plays rounds on all of\n"
+        "them at once, then reports throughput and round-trip latency.\n"
+        "\n"
+        "Options:\n"
+        "  --socket PATH     Server socket (default: kasyno.sock)\n"
+        "  --clients N       Connections (default: 100)\n"
+        "  --sessions N      Sessions per connection (default: 10)\n"
+        "  --rounds N        Rounds per session (default: 100)\n"
+        "  --game NAME       slots, roulette, blackjack or mixed (default: mixed)\n"
+        "  --stake N         Stake of every round (default: 10)\n"
+        "  --balance N       Starting balance of every session (default: 1000000)\n";
+}
+
+/**
+ * @brief Parses a signed number from a reply word
+ * @param word Word to parse
+ * @return int64_t Value (0 if the word is not a number)
+ */
+static int64_t replyNumber(std::string_view word) {
+    int64_t value = 0;
+    std::from_chars(word.data(), word.data() + word.size(), value);
+    return value;
+}
+
+/**
+ * @brief Connects a non-blocking client to the server
+ * @param path Server socket
+ * @return int Socket
+ * @throws std::runtime_error if the server cannot be reached
+ */
+static int connectTo(const std::string& path) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        throw std::invalid_argument("Socket path must be 1-" + std::to_string(sizeof(address.sun_path) - 1) + " bytes");
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size());
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        const std::string message = "Cannot connect to " + path + ": " + std::strerror(errno);
+        if (fd >= 0) close(fd);
+        throw std::runtime_error(message);
+    }
+
+    const int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+    return fd;
+}
+
+/**
+ * @brief Queues the next round of a session
+ * @param client Connection
+ * @param config Options
+ * @param session Session id
+ * @param index Session index in the connection
+ */
+static void sendRound(LoadClient& client, const LoadConfig& config, uint64_t session, size_t index) {
+    static const char* const GAMES[] = {"slots", "roulette", "blackjack"};
+
+    std::string_view game = config.game;
+    if (game == "mixed") game = GAMES[(client.remaining[index] + index) % 3];
+
+    const std::string id = std::to_string(session);
+    const std::string stake = std::to_string(config.stake);
+    if (game == "slots") {
+        client.output += "SLOTS " + id + " " + stake + "\n";
+    } else if (game == "roulette") {
+        client.output += "ROULETTE " + id + " red -1 " + stake + "\n";
+    } else {
+        client.output += "BLACKJACK " + id + " " + stake + "\n";
+    }
+
+    client.sentAt[index] = Clock::now();
+}
+
+/**
+ * @brief Handles one reply line
+ * @param client Connection
+ * @param config Options
+ * @param line Reply without '\n'
+ * @param stats Results to update
+ */
+static void handleReply(LoadClient& client, const LoadConfig& config, std::string_view line, LoadStats& stats) {
+    std::string_view words[6];
+    size_t count = 0;
+    for (size_t i = 0; i < line.size() && count < 6; ) {
+        size_t end = line.find(' ', i);
+        if (end == std::string_view::npos) end = line.size();
+        words[count++] = line.substr(i, end - i);
+        i = end + 1;
+    }
+    if (count < 2) return;
+
+    const uint64_t session = static_cast<uint64_t>(replyNumber(words[1]));
+
+    if (words[0] == "OPENED") {
+        const size_t index = client.slots.size();
+        client.slots.emplace(session, index);
+        sendRound(client, config, session, index);
+        return;
+    }
+
+    const auto found = client.slots.find(session);
+    if (found == client.slots.end()) {
+        // OPEN failed: the session never existed
+        if (words[0] == "ERR") {
+            ++stats.errors;
+            ++client.finished;
+        }
+        return;
+    }
+
+    const size_t index = found->second;
+    if (words[0] == "CLOSED") {
+        ++client.finished;
+        return;
+    }
+
+    if (words[0] == "OK" && count >= 5) {
+        ++stats.rounds;
+        stats.staked += replyNumber(words[3]);
+        stats.paid += replyNumber(words[4]);
+    } else if (words[0] == "ERR") {
+        ++stats.errors;
+    }
+
+    stats.latencies.push_back(static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - client.sentAt[index]).count()));
+
+    if (--client.remaining[index] > 0) {
+        sendRound(client, config, session, index);
+    } else {
+        client.output += "CLOSE " + std::to_string(session) + "\n";
+    }
+}
+
+/**
+ * @brief Gets a percentile of sorted values
+ * @param sorted Values in ascending order (not empty)
+ * @param fraction Percentile (0-1)
+ * @return double Value in microseconds
+ */
+static double percentileUs(const std::vector<uint64_t>& sorted, double fraction) {
+    const size_t index = std::min(sorted.size() - 1, static_cast<size_t>(fraction * static_cast<double>(sorted.size())));
+    return static_cast<double>(sorted[index]) / 1000.0;
+}
+
+/**
+ * @brief Runs the load against the server
+ * @param config Options
+ * @return LoadStats Results
+ * @throws std::runtime_error if the server cannot be reached or a socket fails
+ */
+static LoadStats runLoad(const LoadConfig& config) {
+    std::vector<LoadClient> clients(config.clients);
+    LoadStats stats;
+    stats.latencies.reserve(config.clients * config.sessions * config.rounds);
+
+    for (size_t c = 0; c < clients.size(); ++c) {
+        LoadClient& client = clients[c];
+        client.fd = connectTo(config.socketPath);
+        client.remaining.assign(config.sessions, config.rounds);
+        client.sentAt.resize(config.sessions);
+        for (size_t s = 0; s < config.sessions; ++s) {
+            client.output += "OPEN load" + std::to_string(c) + "_" + std::to_string(s) + " " +
+                             std::to_string(config.balance) + "\n";
+        }
+    }
+
+    std::vector<pollfd> polled;
+    std::vector<size_t> polledIndex;
+    char buffer[16384];
+    size_t active = clients.size();
+
+    while (active > 0) {
+        polled.clear();
+        polledIndex.clear();
+        for (size_t c = 0; c < clients.size(); ++c) {
+            if (clients[c].fd < 0) continue;
+            const short events = static_cast<short>(POLLIN | (clients[c].written < clients[c].output.size() ? POLLOUT : 0));
+            polled.push_back(pollfd{clients[c].fd, events, 0});
+            polledIndex.push_back(c);
+        }
+
+        if (poll(polled.data(), polled.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error(std::string("poll: ") + std::strerror(errno));
+        }
+
+        for (size_t i = 0; i < polled.size(); ++i) {
+            LoadClient& client = clients[polledIndex[i]];
+
+            if (polled[i].revents & (POLLIN | POLLHUP | POLLERR)) {
+                const ssize_t count = read(client.fd, buffer, sizeof(buffer));
+                if (count == 0 || (count < 0 && errno != EAGAIN && errno != EINTR)) {
+                    throw std::runtime_error("Server closed the connection");
+                }
+
+                if (count > 0) {
+                    client.input.append(buffer, static_cast<size_t>(count));
+                    size_t start = 0;
+                    for (size_t end; (end = client.input.find('\n', start)) != std::string::npos; start = end + 1) {
+                        handleReply(client, config, std::string_view(client.input).substr(start, end - start), stats);
+                    }
+                    client.input.erase(0, start);
+                }
+            }
+
+            while (client.written < client.output.size()) {
+                const ssize_t count = send(client.fd, client.output.data() + client.written,
+                                           client.output.size() - client.written, SEND_FLAGS);
+                if (count < 0) {
+                    if (errno == EINTR) continue;
+                    if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+                    throw std::runtime_error(std::string("send: ") + std::strerror(errno));
+                }
+                client.written += static_cast<size_t>(count);
+            }
+            if (client.written == client.output.size()) {
+                client.output.clear();
+                client.written = 0;
+            }
+
+            if (client.finished == config.sessions) {
+                close(client.fd);
+                client.fd = -1;
+                --active;
+            }
+        }
+    }
+
+    return stats;
+}
+
+/**
+ * @brief Main entry point of the load generator
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return int Exit code (0 if every request succeeded)
+ */
+int main(int argc, char** argv) {
+    std::vector<std::string> args(argv + 1, argv + argc);
+    LoadConfig config;
+
+    try {
+        for (size_t i = 0; i < args.size(); ++i) {
+            const std::string& option = args[i];
+            if (option == "--help" || option == "-h") {
+                printUsage();
+                return 0;
+            }
+
+            if (i + 1 >= args.size()) {
+                throw std::invalid_argument("Missing value for " + option);
+            }
+            const std::string& value = args[++i];
+
+            if (option == "--socket") {
+                config.socketPath = value;
+            } else if (option == "--clients") {
+                config.clients = CommandLine::parseNumber<size_t>(option, value);
+            } else if (option == "--sessions") {
+                config.sessions = CommandLine::parseNumber<size_t>(option, value);
+            } else if (option == "--rounds") {
+                config.rounds = CommandLine::parseNumber<uint64_t>(option, value);
+            } else if (option == "--game") {
+                if (value != "slots" && value != "roulette" && value != "blackjack" && value != "mixed") {
+                    throw std::invalid_argument("Invalid value for " + option + ": '" + value + "'");
+                }
+                config.game = value;
+            } else if (option == "--stake") {
+                config.stake = CommandLine::parseNumber<int>(option, value);
+            } else if (option == "--balance") {
+                config.balance = CommandLine::parseNumber<int>(option, value);
+            } else {
+                throw std::invalid_argument("Unknown option: " + option);
+            }
+        }
+
+        if (config.clients == 0 || config.sessions == 0 || config.rounds == 0) {
+            throw std::invalid_argument("--clients, --sessions and --rounds must be at least 1");
+        }
+
+        const auto start = Clock::now();
+        LoadStats stats = runLoad(config);
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        std::sort(stats.latencies.begin(), stats.latencies.end());
+        const uint64_t answered = stats.latencies.size();
+
+        std::printf("Clients:      %zu x %zu sessions (%zu tables)\n",
+                    config.clients, config.sessions, config.clients * config.sessions);
+        std::printf("Rounds:       %llu in %.3f s (%.0f rounds/s)\n",
+                    static_cast<unsigned long long>(stats.rounds), seconds,
+                    seconds > 0.0 ? static_cast<double>(stats.rounds) / seconds : 0.0);
+        std::printf("Errors:       %llu\n", static_cast<unsigned long long>(stats.errors));
+        std::printf("Return:       %.4f\n",
+                    stats.staked ? static_cast<double>(stats.paid) / static_cast<double>(stats.staked) : 0.0);
+        if (answered > 0) {
+            std::printf("Latency (us): p50 %.1f  p90 %.1f  p99 %.1f  max %.1f\n",
+                        percentileUs(stats.latencies, 0.50), percentileUs(stats.latencies, 0.90),
+                        percentileUs(stats.latencies, 0.99), static_cast<double>(stats.latencies.back()) / 1000.0);
+        }
+
+        return stats.errors == 0 ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
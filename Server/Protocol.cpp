@@ -0,0 +1,148 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "Protocol.h"
+
+#include <array>
+#include <charconv>
+#include <stdexcept>
+
+/// @brief Protocol names of the roulette bet types, in RouletteBetType order
+static constexpr std::array<std::string_view, 14> BET_NAMES = {
+    "red", "black", "green", "number", "odd", "even", "low", "high",
+    "split", "street", "corner", "sixline", "dozen", "column"
+};
+
+/// @brief Command words, in RequestType order
+static constexpr std::array<std::string_view, 6> COMMANDS = {
+    "OPEN", "SLOTS", "ROULETTE", "BLACKJACK", "BALANCE", "CLOSE"
+};
+
+/// @brief Words each command takes, including the command itself
+static constexpr std::array<size_t, 6> WORD_COUNTS = {3, 3, 5, 3, 2, 2};
+
+static constexpr size_t MAX_WORDS = 5;  ///< Longest request (ROULETTE)
+
+/**
+ * @brief Parses a whole word as an integer
+ * @param word Word to parse
+ * @param what Field name (for error messages)
+ * @return Value Parsed value
+ * @throws std::invalid_argument if the word is not a number of that type
+ */
+template <typename Value>
+static Value parseNumber(std::string_view word, const char* what) {
+    Value value{};
+    const auto [end, error] = std::from_chars(word.data(), word.data() + word.size(), value);
+    if (error != std::errc() || end != word.data() + word.size()) {
+        throw std::invalid_argument("Protocol::parse: invalid " + std::string(what) + " '" + std::string(word) + "'");
+    }
+    return value;
+}
+
+Request Protocol::parse(std::string_view line) {
+    if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+    if (line.size() > MAX_LINE) {
+        throw std::invalid_argument("Protocol::parse: line is longer than " + std::to_string(MAX_LINE) + " bytes");
+    }
+
+    std::array<std::string_view, MAX_WORDS> words;
+    size_t count = 0;
+    for (size_t i = 0; i < line.size(); ) {
+        if (line[i] == ' ') {
+            ++i;
+            continue;
+        }
+
+        size_t end = line.find(' ', i);
+        if (end == std::string_view::npos) end = line.size();
+        if (count == MAX_WORDS) {
+            throw std::invalid_argument("Protocol::parse: too many words");
+        }
+        words[count++] = line.substr(i, end - i);
+        i = end;
+    }
+
+    if (count == 0) {
+        throw std::invalid_argument("Protocol::parse: empty request");
+    }
+
+    size_t command = 0;
+    while (command < COMMANDS.size() && COMMANDS[command] != words[0]) ++command;
+    if (command == COMMANDS.size()) {
+        throw std::invalid_argument("Protocol::parse: unknown command '" + std::string(words[0]) + "'");
+    }
+
+    if (count != WORD_COUNTS[command]) {
+        throw std::invalid_argument(
+            "Protocol::parse: " + std::string(words[0]) + " takes " +
+            std::to_string(WORD_COUNTS[command] - 1) + " arguments"
+        );
+    }
+
+    Request request;
+    request.type = static_cast<RequestType>(command);
+
+    switch (request.type) {
+        case RequestType::OPEN:
+            request.name = words[1];
+            request.amount = parseNumber<int>(words[2], "balance");
+            if (request.amount < 0 || request.amount > MAX_BALANCE) {
+                throw std::invalid_argument(
+                    "Protocol::parse: balance must be between 0 and " + std::to_string(MAX_BALANCE)
+                );
+            }
+            break;
+        case RequestType::ROULETTE: {
+            request.session = parseNumber<uint64_t>(words[1], "session");
+
+            size_t bet = 0;
+            while (bet < BET_NAMES.size() && BET_NAMES[bet] != words[2]) ++bet;
+            if (bet == BET_NAMES.size()) {
+                throw std::invalid_argument("Protocol::parse: unknown roulette bet '" + std::string(words[2]) + "'");
+            }
+
+            request.betType = static_cast<RouletteBetType>(bet);
+            if (request.betType == RouletteBetType::BET_SPLIT) {
+                // Splits name both numbers in one word: "split 0-3"
+                const size_t dash = words[3].find('-', 1);
+                if (dash == std::string_view::npos) {
+                    throw std::invalid_argument("Protocol::parse: split needs two numbers like 0-3, got '" +
+                                                std::string(words[3]) + "'");
+                }
+                request.number = parseNumber<int>(words[3].substr(0, dash), "number");
+                request.second = parseNumber<int>(words[3].substr(dash + 1), "number");
+            } else {
+                request.number = parseNumber<int>(words[3], "number");
+            }
+            request.amount = parseNumber<int>(words[4], "stake");
+            break;
+        }
+        case RequestType::SLOTS:
+        case RequestType::BLACKJACK:
+            request.session = parseNumber<uint64_t>(words[1], "session");
+            request.amount = parseNumber<int>(words[2], "stake");
+            break;
+        case RequestType::BALANCE:
+        case RequestType::CLOSE:
+            request.session = parseNumber<uint64_t>(words[1], "session");
+            break;
+    }
+
+    return request;
+}
+
+std::string_view Protocol::betName(RouletteBetType type) {
+    return BET_NAMES[static_cast<size_t>(type)];
+}
+
+std::string Protocol::error(uint64_t session, std::string_view message) {
+    std::string reply = "ERR " + std::to_string(session) + " ";
+    for (char c : message) {
+        reply += (c == '\n' || c == '\r') ? ' ' : c;
+    }
+    reply += '\n';
+    return reply;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file Protocol.h
+ * @brief Line protocol spoken by kasyno_server and kasyno_loadgen
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_PROTOCOL_H
+#define KASYNO_PROTOCOL_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "../Games/RouletteTypes.h"
+
+/**
+ * @enum RequestType
+ * @brief Commands a client can send
+ */
+enum class RequestType {
+    OPEN = 0,   ///< OPEN <name> <balance (0-MAX_BALANCE)>     -> OPENED <session> <balance>
+    SLOTS,      ///< SLOTS <session> <stake>                   -> OK <session> <balance> <staked> <paid> <result>
+    ROULETTE,   ///< ROULETTE <session> <bet> <number> <stake> -> OK ...
+    BLACKJACK,  ///< BLACKJACK <session> <stake>               -> OK ...
+    BALANCE,    ///< BALANCE <session>                         -> BALANCE <session> <balance>
+    CLOSE,      ///< CLOSE <session>                           -> CLOSED <session> <balance>
+};
+
+/**
+ * @struct Request
+ * @brief One parsed command line
+ */
+struct Request {
+    RequestType type = RequestType::OPEN;                 ///< Command
+    uint64_t session = 0;                                 ///< Target session (all but OPEN)
+    std::string name;                                     ///< Player name (OPEN)
+    int amount = 0;                                       ///< Starting balance (OPEN) or stake
+    RouletteBetType betType = RouletteBetType::BET_RED;   ///< Roulette bet type (ROULETTE)
+    int number = -1;                                      ///< Roulette number, -1 if the bet needs none (ROULETTE)
+    int second = -1;                                      ///< Other number of a split (ROULETTE split)
+};
+
+/**
+ * @class Protocol
+ * @brief Parses request lines and formats replies
+ *
+ * Every request and reply is one '\n'-terminated line of space-separated
+ * words. Failed requests are answered with "ERR <session> <message>"
+ * (session 0 for OPEN and for lines that do not parse). Replies carry the
+ * session id, errors included, because requests for different sessions
+ * may be answered out of order.
+ *
+ * Roulette bets are named after RouletteBetType: red, black, green,
+ * number, odd, even, low, high, split, street, corner, sixline, dozen,
+ * column. A split names both of its numbers in one word ("split 0-3").
+ */
+class Protocol {
+public:
+    static constexpr size_t MAX_LINE = 256;         ///< Longest accepted request line (bytes, without '\n')
+    static constexpr int MAX_BALANCE = 100'000'000; ///< Largest starting balance of OPEN
+
+    /**
+     * @brief Parses one request line
+     * @param line Line without the trailing '\n' ('\r' is ignored)
+     * @return Request Parsed request
+     * @throws std::invalid_argument if the line is not a valid request
+     */
+    static Request parse(std::string_view line);
+
+    /**
+     * @brief Gets the protocol name of a roulette bet type
+     * @param type Bet type
+     * @return std::string_view Name used on the wire
+     */
+    static std::string_view betName(RouletteBetType type);
+
+    /**
+     * @brief Formats an error reply
+     * @param session Session the request named (0 for OPEN or an unparsable line)
+     * @param message Error message (line breaks are replaced)
+     * @return std::string Reply line including '\n'
+     */
+    static std::string error(uint64_t session, std::string_view message);
+};
+
+#endif //KASYNO_PROTOCOL_H
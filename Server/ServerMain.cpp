@@ -0,0 +1,117 @@
+/**
+ * @file ServerMain.cpp
+ * @brief Entry point of kasyno_server, the multi-session game server
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "SessionServer.h"
+#include "../CommandLine.h"
+
+static SessionServer* runningServer = nullptr;  ///< Server stopped by SIGINT/SIGTERM
+
+/**
+ * @brief Stops the server on SIGINT/SIGTERM
+ * @param signal Signal number (unused)
+ */
+static void onStopSignal(int /*signal*/) {
+    if (runningServer) runningServer->stop();
+}
+
+/**
+ * @brief Prints command line usage
+ */
+static void printUsage() {
+    std::cout <<
+        "Usage: kasyno_server [options]\n"
+        "\n"
+        "Hosts independent game sessions for many clients over a Unix socket.\n"
+        "\n"
+        "Options:\n"
+        "  --socket PATH      Socket to listen on (default: kasyno.sock)\n"
+        "  --workers N        Worker threads (default: all hardware threads)\n"
+        "  --seed N           Master seed of the session RNG streams (default: random)\n"
+        "  --max-clients N    Maximum simultaneous connections (default: 16384)\n"
+        "\n"
+        "Protocol (one request per line, replies carry the session id):\n"
+        "  OPEN <name> <balance>                     -> OPENED <session> <balance>   (balance: 0-100000000)\n"
+        "  SLOTS <session> <stake>                   -> OK <session> <balance> <staked> <paid> <result>\n"
+        "  ROULETTE <session> <bet> <number> <stake> -> OK ...   (bet: red, number, dozen, ...; split 0-3)\n"
+        "  BLACKJACK <session> <stake>               -> OK ...\n"
+        "  BALANCE <session>                         -> BALANCE <session> <balance>\n"
+        "  CLOSE <session>                           -> CLOSED <session> <balance>\n"
+        "  errors                                    -> ERR <session> <message>\n";
+}
+
+/**
+ * @brief Main entry point of the server
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return int Exit code (0 for success)
+ */
+int main(int argc, char** argv) {
+    std::vector<std::string> args(argv + 1, argv + argc);
+
+    ServerConfig config;
+    config.seed = (static_cast<uint64_t>(std::random_device{}()) << 32) ^ std::random_device{}();
+
+    try {
+        for (size_t i = 0; i < args.size(); ++i) {
+            const std::string& option = args[i];
+            if (option == "--help" || option == "-h") {
+                printUsage();
+                return 0;
+            }
+
+            if (i + 1 >= args.size()) {
+                throw std::invalid_argument("Missing value for " + option);
+            }
+            const std::string& value = args[++i];
+
+            if (option == "--socket") {
+                config.socketPath = value;
+            } else if (option == "--workers") {
+                config.workers = CommandLine::parseNumber<unsigned>(option, value);
+            } else if (option == "--seed") {
+                config.seed = CommandLine::parseNumber<uint64_t>(option, value);
+            } else if (option == "--max-clients") {
+                config.maxConnections = CommandLine::parseNumber<size_t>(option, value);
+            } else {
+                throw std::invalid_argument("Unknown option: " + option);
+            }
+        }
+
+        SessionServer server(config);
+        runningServer = &server;
+        std::signal(SIGINT, onStopSignal);
+        std::signal(SIGTERM, onStopSignal);
+
+        std::cout << "Listening on " << config.socketPath << " (Ctrl+C to stop)" << std::endl;
+        const auto start = std::chrono::steady_clock::now();
+        server.run();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        runningServer = nullptr;
+
+        const ServerStats stats = server.getStats();
+        std::printf("Connections:  %llu\n", static_cast<unsigned long long>(stats.connections));
+        std::printf("Sessions:     %llu\n", static_cast<unsigned long long>(stats.sessionsOpened));
+        std::printf("Requests:     %llu (%.0f/s)\n", static_cast<unsigned long long>(stats.requests),
+                    seconds > 0.0 ? static_cast<double>(stats.requests) / seconds : 0.0);
+        std::printf("Rounds:       %llu\n", static_cast<unsigned long long>(stats.rounds));
+        std::printf("Errors:       %llu\n", static_cast<unsigned long long>(stats.errors));
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
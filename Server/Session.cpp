@@ -0,0 +1,83 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "Session.h"
+
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+Session::Session(uint64_t id, uint64_t owner, const std::string& name, int balance, Rng rng)
+    : id(id)
+    , owner(owner)
+    , player(name, balance)
+    , random(std::move(rng))
+    , blackjack(random) {
+}
+
+RoundOutcome Session::play(GameEngine& engine, const BetSlip& slip, int stake) {
+    const int balance = player.getBalance();
+    const int winnings = player.getWinnings();
+
+    // The balance is an int: the best possible round must still fit in it
+    const int64_t left = static_cast<int64_t>(balance) - stake;
+    if (left >= 0 && engine.maxPayout(slip) > std::numeric_limits<int>::max() - left) {
+        throw std::invalid_argument(
+            "Session::play: stake (" + std::to_string(stake) + ") could win more than a balance of " +
+            std::to_string(balance) + " can hold"
+        );
+    }
+
+    player.placeBet(stake);
+
+    try {
+        const RoundOutcome outcome = engine.resolveRound(slip, random);
+
+        // Blackjack doubles and splits stake more than the original bet
+        if (outcome.staked > stake) {
+            player.updateBalance(-static_cast<int>(outcome.staked - stake));
+        }
+        player.settleBet(static_cast<int>(outcome.paid));
+        ++rounds;
+        return outcome;
+    } catch (...) {
+        // Leaves the player as before the round, whatever step failed
+        player.setCurrentBet(0);
+        player.setBalance(balance);
+        player.setWinnings(winnings);
+        throw;
+    }
+}
+
+std::string Session::handle(const Request& request) {
+    RoundOutcome outcome;
+
+    switch (request.type) {
+        case RequestType::SLOTS:
+            outcome = play(slots, BetSlip::single(request.amount), request.amount);
+            break;
+        case RequestType::ROULETTE: {
+            const RouletteBet bet = RouletteRules::makeBet(request.betType, request.number, request.amount,
+                                                            request.second);
+            outcome = play(roulette, BetSlip{0, 0, std::span<const RouletteBet>(&bet, 1)}, request.amount);
+            break;
+        }
+        case RequestType::BLACKJACK:
+            outcome = play(blackjack, BetSlip::single(request.amount, player.getBalance() - request.amount),
+                           request.amount);
+            break;
+        case RequestType::BALANCE:
+            return "BALANCE " + std::to_string(id) + " " + std::to_string(player.getBalance()) + "\n";
+        case RequestType::CLOSE:
+            return "CLOSED " + std::to_string(id) + " " + std::to_string(player.getBalance()) + "\n";
+        case RequestType::OPEN:
+            throw std::logic_error("Session::handle: OPEN is handled by the server");
+    }
+
+    return "OK " + std::to_string(id) + " " + std::to_string(player.getBalance()) + " " +
+           std::to_string(outcome.staked) + " " + std::to_string(outcome.paid) + " " +
+           std::to_string(outcome.result) + "\n";
+}
@@ -0,0 +1,102 @@
+/**
+ * @file Session.h
+ * @brief One player's table hosted by kasyno_server
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_SESSION_H
+#define KASYNO_SESSION_H
+
+#include <cstdint>
+#include <string>
+
+#include "Protocol.h"
+#include "../Player.h"
+#include "../Rng.h"
+#include "../Games/BlackjackEngine.h"
+#include "../Games/RouletteEngine.h"
+#include "../Games/SlotsEngine.h"
+
+/**
+ * @class Session
+ * @brief Player, game engines and a private RNG stream of one client table
+ *
+ * The server-side counterpart of Casino + Game: instead of a blocking
+ * state machine on stdin, every request is one handle() call. A session
+ * is only ever touched by the worker that owns it, so it needs no locks.
+ */
+class Session {
+    uint64_t id;                ///< Session id sent to the client
+    uint64_t owner;             ///< Connection that opened the session
+    Player player;              ///< Player and balance
+    Rng random;                 ///< Private substream (declared before the engines using it)
+    SlotsEngine slots;          ///< Slots rules
+    RouletteEngine roulette;    ///< Roulette rules
+    BlackjackEngine blackjack;  ///< Blackjack rules and shoe
+    uint64_t rounds = 0;        ///< Rounds played
+
+    /**
+     * @brief Plays one round and settles it with the player
+     * @param engine Game to play
+     * @param slip Bets of the round
+     * @param stake Money taken up front
+     * @return RoundOutcome Money result
+     * @throws std::invalid_argument if the stake is not affordable or could overflow the balance
+     *         (the player is left as before the round on any exception)
+     */
+    RoundOutcome play(GameEngine& engine, const BetSlip& slip, int stake);
+
+public:
+    /**
+     * @brief Constructor
+     * @param id Session id
+     * @param owner Connection id of the client
+     * @param name Player name
+     * @param balance Starting balance
+     * @param rng Generator for this session (e.g. Rng::split())
+     * @throws std::invalid_argument if the name is empty or the balance negative
+     */
+    Session(uint64_t id, uint64_t owner, const std::string& name, int balance, Rng rng);
+
+    Session(const Session&) = delete;
+    Session& operator=(const Session&) = delete;
+
+    /**
+     * @brief Executes a request
+     * @param request Parsed request (not OPEN)
+     * @return std::string Reply line including '\n'
+     * @throws std::invalid_argument if the bet is not valid or not affordable
+     */
+    std::string handle(const Request& request);
+
+    /**
+     * @brief Gets the session id
+     * @return uint64_t Id
+     */
+    uint64_t getId() const { return id; }
+
+    /**
+     * @brief Gets the connection that opened the session
+     * @return uint64_t Connection id
+     */
+    uint64_t getOwner() const { return owner; }
+
+    /**
+     * @brief Gets the player
+     * @return const Player& Player
+     */
+    const Player& getPlayer() const { return player; }
+
+    /**
+     * @brief Gets the number of rounds played
+     * @return uint64_t Rounds
+     */
+    uint64_t getRounds() const { return rounds; }
+};
+
+#endif //KASYNO_SESSION_H
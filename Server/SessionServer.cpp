@@ -0,0 +1,404 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "SessionServer.h"
+
+#include <cerrno>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#ifdef MSG_NOSIGNAL
+static constexpr int SEND_FLAGS = MSG_NOSIGNAL;  ///< A vanished client must not raise SIGPIPE
+#else
+static constexpr int SEND_FLAGS = 0;
+#endif
+
+/**
+ * @brief Builds an error message with the text of errno
+ * @param what Failed operation
+ * @return std::string Message
+ */
+static std::string systemError(const std::string& what) {
+    return "SessionServer: " + what + ": " + std::strerror(errno);
+}
+
+/**
+ * @brief Switches a descriptor to non-blocking mode
+ * @param fd Descriptor
+ * @return bool True on success
+ */
+static bool setNonBlocking(int fd) {
+    const int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+SessionServer::SessionServer(ServerConfig config)
+    : config(std::move(config))
+    , streams(Rng::forStream(this->config.seed, 0))
+    , pool(this->config.workers) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (this->config.socketPath.empty() || this->config.socketPath.size() >= sizeof(address.sun_path)) {
+        throw std::invalid_argument(
+            "SessionServer::SessionServer: socket path must be 1-" +
+            std::to_string(sizeof(address.sun_path) - 1) + " bytes"
+        );
+    }
+    std::memcpy(address.sun_path, this->config.socketPath.c_str(), this->config.socketPath.size());
+
+    // A socket file left behind by a killed server would make bind() fail
+    struct stat info{};
+    if (stat(this->config.socketPath.c_str(), &info) == 0 && S_ISSOCK(info.st_mode)) {
+        unlink(this->config.socketPath.c_str());
+    }
+
+    int wake[2];
+    if (pipe(wake) != 0) {
+        throw std::runtime_error(systemError("pipe"));
+    }
+    wakeRead = wake[0];
+    wakeWrite = wake[1];
+    setNonBlocking(wakeRead);
+    setNonBlocking(wakeWrite);
+
+    listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0 || !setNonBlocking(listenFd) ||
+        bind(listenFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(listenFd, SOMAXCONN) != 0) {
+        const std::string message = systemError("cannot listen on " + this->config.socketPath);
+        if (listenFd >= 0) close(listenFd);
+        close(wakeRead);
+        close(wakeWrite);
+        throw std::runtime_error(message);
+    }
+}
+
+SessionServer::~SessionServer() {
+    // Tasks still running post replies through the wake pipe
+    pool.wait();
+
+    for (auto& [id, connection] : connections) {
+        close(connection.fd);
+    }
+
+    close(listenFd);
+    close(wakeRead);
+    close(wakeWrite);
+    unlink(config.socketPath.c_str());
+}
+
+SessionServer::Reply SessionServer::execute(Mailbox& mailbox, const Request& request) {
+    try {
+        if (request.type == RequestType::OPEN) {
+            if (mailbox.session || !mailbox.stream) {
+                throw std::logic_error("SessionServer: session is already open");
+            }
+
+            mailbox.session = std::make_unique<Session>(mailbox.id, mailbox.owner, request.name, request.amount,
+                                                        std::move(*mailbox.stream));
+            mailbox.stream.reset();
+            sessionsOpened.fetch_add(1, std::memory_order_relaxed);
+            return Reply{mailbox.owner,
+                "OPENED " + std::to_string(mailbox.id) + " " + std::to_string(request.amount) + "\n"};
+        }
+
+        if (!mailbox.session) {
+            throw std::invalid_argument("SessionServer: unknown session");
+        }
+
+        Session& session = *mailbox.session;
+        const uint64_t played = session.getRounds();
+        Reply reply{mailbox.owner, session.handle(request)};
+        rounds.fetch_add(session.getRounds() - played, std::memory_order_relaxed);
+
+        if (request.type == RequestType::CLOSE) {
+            mailbox.session.reset();
+            reply.endsSession = true;
+            reply.session = mailbox.id;
+        }
+        return reply;
+    } catch (const std::exception& e) {
+        errors.fetch_add(1, std::memory_order_relaxed);
+
+        Reply reply{mailbox.owner, Protocol::error(request.type == RequestType::OPEN ? 0 : request.session, e.what())};
+        if (request.type == RequestType::OPEN) {
+            mailbox.stream.reset();
+            reply.endsSession = true;
+            reply.session = mailbox.id;
+        }
+        return reply;
+    }
+}
+
+void SessionServer::serve(const std::shared_ptr<Mailbox>& mailbox) {
+    std::vector<Request> batch;
+    {
+        std::lock_guard<std::mutex> lock(mailbox->mutex);
+        batch.swap(mailbox->inbox);
+    }
+
+    std::vector<Reply> done;
+    done.reserve(batch.size());
+    for (const Request& request : batch) {
+        done.push_back(execute(*mailbox, request));
+    }
+    postReplies(done);
+
+    // Mail that arrived meanwhile gets a new task, so a pipelining client
+    // cannot keep a worker to itself
+    bool more;
+    {
+        std::lock_guard<std::mutex> lock(mailbox->mutex);
+        more = !mailbox->inbox.empty();
+        mailbox->scheduled = more;
+    }
+    if (more) {
+        pool.submit([this, mailbox] { serve(mailbox); });
+    }
+}
+
+void SessionServer::deliver(const std::shared_ptr<Mailbox>& mailbox, Request request) {
+    bool idle;
+    {
+        std::lock_guard<std::mutex> lock(mailbox->mutex);
+        mailbox->inbox.push_back(std::move(request));
+        idle = !std::exchange(mailbox->scheduled, true);
+    }
+    if (idle) {
+        pool.submit([this, mailbox] { serve(mailbox); });
+    }
+}
+
+void SessionServer::postReplies(std::vector<Reply>& done) {
+    if (done.empty()) return;
+
+    bool wasEmpty;
+    {
+        std::lock_guard<std::mutex> lock(replyMutex);
+        wasEmpty = replies.empty();
+        if (wasEmpty) {
+            replies.swap(done);
+        } else {
+            replies.insert(replies.end(), std::make_move_iterator(done.begin()), std::make_move_iterator(done.end()));
+        }
+    }
+    done.clear();
+
+    // Only the first batch of a burst needs to wake the event loop
+    if (wasEmpty) wake();
+}
+
+void SessionServer::wake() const {
+    const char byte = 1;
+    [[maybe_unused]] const ssize_t ignored = write(wakeWrite, &byte, 1);
+}
+
+void SessionServer::stop() {
+    stopRequested.store(true);
+    wake();
+}
+
+ServerStats SessionServer::getStats() const {
+    ServerStats result = stats;
+    result.sessionsOpened = sessionsOpened.load(std::memory_order_relaxed);
+    result.rounds = rounds.load(std::memory_order_relaxed);
+    result.errors = errors.load(std::memory_order_relaxed);
+    return result;
+}
+
+void SessionServer::acceptClients() {
+    while (true) {
+        const int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0) {
+            if (errno == EINTR) continue;
+            return;  // EAGAIN: nothing left; anything else: retried on the next poll
+        }
+
+        if (connections.size() >= config.maxConnections || !setNonBlocking(fd)) {
+            close(fd);
+            continue;
+        }
+
+        Connection connection;
+        connection.fd = fd;
+        connections.emplace(nextConnection++, std::move(connection));
+        ++stats.connections;
+    }
+}
+
+bool SessionServer::readClient(uint64_t id, Connection& connection) {
+    char buffer[READ_CHUNK];
+    const ssize_t count = read(connection.fd, buffer, sizeof(buffer));
+    if (count == 0) return false;
+    if (count < 0) return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+
+    connection.input.append(buffer, static_cast<size_t>(count));
+
+    size_t start = 0;
+    for (size_t end; (end = connection.input.find('\n', start)) != std::string::npos; start = end + 1) {
+        const std::string_view line(connection.input.data() + start, end - start);
+        ++stats.requests;
+
+        Request request;
+        try {
+            request = Protocol::parse(line);
+        } catch (const std::exception& e) {
+            // Only a line that does not parse has no session to answer for
+            connection.output += Protocol::error(0, e.what());
+            errors.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        // Replies to other requests may still be on the way, so errors carry the session id too
+        try {
+            if (request.type == RequestType::OPEN) {
+                const uint64_t session = nextSession++;
+                auto mailbox = std::make_shared<Mailbox>(session, id, streams.split());
+                mailboxes.emplace(session, mailbox);
+                connection.sessions.insert(session);
+                deliver(mailbox, std::move(request));
+                continue;
+            }
+
+            const auto found = mailboxes.find(request.session);
+            if (found == mailboxes.end() || found->second->owner != id) {
+                throw std::invalid_argument("SessionServer: unknown session");
+            }
+            deliver(found->second, std::move(request));
+        } catch (const std::exception& e) {
+            connection.output += Protocol::error(request.session, e.what());
+            errors.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    connection.input.erase(0, start);
+
+    if (connection.input.size() > Protocol::MAX_LINE + 1) {
+        connection.output += Protocol::error(0, "SessionServer: request line too long");
+        errors.fetch_add(1, std::memory_order_relaxed);
+        connection.input.clear();
+        connection.closing = true;
+    }
+
+    return true;
+}
+
+bool SessionServer::flushClient(Connection& connection) {
+    while (connection.written < connection.output.size()) {
+        const ssize_t count = send(connection.fd, connection.output.data() + connection.written,
+                                   connection.output.size() - connection.written, SEND_FLAGS);
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        connection.written += static_cast<size_t>(count);
+    }
+
+    connection.output.clear();
+    connection.written = 0;
+    return true;
+}
+
+void SessionServer::deliverReplies() {
+    char drain[256];
+    while (read(wakeRead, drain, sizeof(drain)) > 0) {}
+
+    // The pipe is drained before taking the replies, so a wake-up written
+    // after this point is never lost
+    std::vector<Reply> batch;
+    {
+        std::lock_guard<std::mutex> lock(replyMutex);
+        batch.swap(replies);
+    }
+
+    for (Reply& reply : batch) {
+        const auto found = connections.find(reply.connection);
+        if (found == connections.end()) continue;
+
+        found->second.output += reply.text;
+        if (reply.endsSession) {
+            mailboxes.erase(reply.session);
+            found->second.sessions.erase(reply.session);
+        }
+    }
+}
+
+void SessionServer::closeClient(uint64_t id) {
+    const auto found = connections.find(id);
+    if (found == connections.end()) return;
+
+    // Tasks already queued keep their mailbox alive; their replies are dropped
+    for (uint64_t session : found->second.sessions) {
+        mailboxes.erase(session);
+    }
+
+    close(found->second.fd);
+    connections.erase(found);
+}
+
+void SessionServer::run() {
+    std::vector<pollfd> polled;
+    std::vector<uint64_t> polledIds;
+    std::vector<uint64_t> closed;
+
+    while (!stopRequested.load()) {
+        polled.clear();
+        polledIds.clear();
+        polled.push_back(pollfd{listenFd, POLLIN, 0});
+        polled.push_back(pollfd{wakeRead, POLLIN, 0});
+
+        for (const auto& [id, connection] : connections) {
+            short events = 0;
+            const size_t pending = connection.output.size() - connection.written;
+            if (!connection.closing && pending < MAX_PENDING_OUTPUT) events |= POLLIN;
+            if (pending > 0) events |= POLLOUT;
+            polled.push_back(pollfd{connection.fd, events, 0});
+            polledIds.push_back(id);
+        }
+
+        if (poll(polled.data(), polled.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error(systemError("poll"));
+        }
+
+        if (polled[1].revents & POLLIN) {
+            deliverReplies();
+        }
+
+        closed.clear();
+        for (size_t i = 0; i < polledIds.size(); ++i) {
+            const short revents = polled[i + 2].revents;
+            if (revents == 0) continue;
+
+            Connection& connection = connections.at(polledIds[i]);
+            if ((revents & (POLLIN | POLLHUP | POLLERR)) && !connection.closing &&
+                !readClient(polledIds[i], connection)) {
+                closed.push_back(polledIds[i]);
+            }
+        }
+
+        // Replies go out right away instead of waiting for the next POLLOUT
+        for (auto& [id, connection] : connections) {
+            if (connection.written < connection.output.size() && !flushClient(connection)) {
+                closed.push_back(id);
+            } else if (connection.closing && connection.output.empty()) {
+                closed.push_back(id);
+            }
+        }
+
+        for (uint64_t id : closed) closeClient(id);
+
+        if (polled[0].revents & POLLIN) {
+            acceptClients();
+        }
+    }
+}
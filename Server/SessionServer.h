@@ -0,0 +1,238 @@
+/**
+ * @file SessionServer.h
+ * @brief Hosts many game sessions in one process over a local socket
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_SESSIONSERVER_H
+#define KASYNO_SESSIONSERVER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Protocol.h"
+#include "Session.h"
+#include "../TaskPool.h"
+
+/**
+ * @struct ServerConfig
+ * @brief Server options
+ */
+struct ServerConfig {
+    std::string socketPath = "kasyno.sock";  ///< Unix domain socket to listen on
+    unsigned workers = 0;                    ///< Pool threads (0 = hardware threads)
+    uint64_t seed = 0;                       ///< Master seed of the session RNG streams
+    size_t maxConnections = 16384;           ///< Clients beyond this are turned away
+};
+
+/**
+ * @struct ServerStats
+ * @brief Counters of a server run
+ */
+struct ServerStats {
+    uint64_t connections = 0;     ///< Clients accepted
+    uint64_t requests = 0;        ///< Request lines received
+    uint64_t sessionsOpened = 0;  ///< Sessions created
+    uint64_t rounds = 0;          ///< Game rounds played
+    uint64_t errors = 0;          ///< Requests answered with ERR
+};
+
+/**
+ * @class SessionServer
+ * @brief Event loop plus a work-stealing pool serving Session objects
+ *
+ * One I/O thread polls the listening socket and every client and splits
+ * the input into request lines (see Protocol). Each session has a mailbox:
+ * a request is appended to it, and a session with mail and no task yet is
+ * scheduled on the TaskPool, where the task plays everything queued so
+ * far. A session is therefore run by one task at a time and is never
+ * locked, but busy sessions (blackjack shoes, pipelining clients) spread
+ * over every core instead of piling up on a fixed shard. Replies are
+ * posted in batches and wake the event loop through a pipe. A client can
+ * drive any number of sessions over one connection; sessions die with
+ * the connection that opened them.
+ *
+ * A client whose replies pile up beyond MAX_PENDING_OUTPUT is not read
+ * until it catches up, so a slow reader cannot make the server buffer
+ * without bound.
+ */
+class SessionServer {
+public:
+    static constexpr size_t MAX_PENDING_OUTPUT = 1 << 20;  ///< Unsent reply bytes before a client is throttled
+    static constexpr size_t READ_CHUNK = 16384;            ///< Bytes read from a client per call
+
+private:
+    /**
+     * @struct Reply
+     * @brief Reply line for a client
+     */
+    struct Reply {
+        uint64_t connection;          ///< Client to send it to
+        std::string text;             ///< Line including '\n'
+        bool endsSession = false;     ///< The session is gone (closed or failed to open)
+        uint64_t session = 0;         ///< Session the reply is for
+    };
+
+    /**
+     * @struct Mailbox
+     * @brief A session with the requests waiting for it
+     */
+    struct Mailbox {
+        uint64_t id;                        ///< Session id
+        uint64_t owner;                     ///< Connection that opened the session
+        std::mutex mutex;                   ///< Guards inbox and scheduled
+        std::vector<Request> inbox;         ///< Requests not taken yet
+        bool scheduled = false;             ///< A task is queued or running for this mailbox
+
+        std::unique_ptr<Session> session;   ///< Created by the OPEN request (task only)
+        std::optional<Rng> stream;          ///< RNG substream until the session takes it (task only)
+
+        Mailbox(uint64_t id, uint64_t owner, Rng stream): id(id), owner(owner), stream(std::move(stream)) {}
+    };
+
+    /**
+     * @struct Connection
+     * @brief Client socket and its buffers (event loop only)
+     */
+    struct Connection {
+        int fd = -1;                            ///< Client socket
+        std::string input;                      ///< Received bytes not yet split into lines
+        std::string output;                     ///< Reply bytes not yet sent
+        size_t written = 0;                     ///< Bytes of output already sent
+        bool closing = false;                   ///< Close once output is sent (protocol error)
+        std::unordered_set<uint64_t> sessions;  ///< Sessions opened by this client
+    };
+
+    ServerConfig config;                                    ///< Options
+    int listenFd = -1;                                      ///< Listening socket
+    int wakeRead = -1;                                      ///< Read end of the wake pipe
+    int wakeWrite = -1;                                     ///< Write end of the wake pipe
+    std::unordered_map<uint64_t, Connection> connections;   ///< Clients by connection id
+    std::unordered_map<uint64_t, std::shared_ptr<Mailbox>> mailboxes;  ///< Sessions by id (event loop only)
+    uint64_t nextConnection = 1;                            ///< Id of the next client
+    uint64_t nextSession = 1;                               ///< Id of the next session (0 means none)
+    Rng streams;                                            ///< Source of session RNG substreams (event loop only)
+
+    std::mutex replyMutex;                                  ///< Guards replies
+    std::vector<Reply> replies;                             ///< Replies posted by tasks
+
+    std::atomic<bool> stopRequested{false};                 ///< stop() was called
+    ServerStats stats;                                      ///< Event loop counters
+    std::atomic<uint64_t> sessionsOpened{0};                ///< Sessions created by tasks
+    std::atomic<uint64_t> rounds{0};                        ///< Rounds played by tasks
+    std::atomic<uint64_t> errors{0};                        ///< ERR replies from tasks and the event loop
+    TaskPool pool;                                          ///< Runs the mailboxes (destroyed first)
+
+    /**
+     * @brief Plays the requests queued in a mailbox (runs on the pool)
+     * @param mailbox Session to serve
+     */
+    void serve(const std::shared_ptr<Mailbox>& mailbox);
+
+    /**
+     * @brief Executes one request of a session
+     * @param mailbox Session
+     * @param request Request
+     * @return Reply Reply for the owner
+     */
+    Reply execute(Mailbox& mailbox, const Request& request);
+
+    /**
+     * @brief Queues a request for a session and schedules it if idle
+     * @param mailbox Session
+     * @param request Request
+     */
+    void deliver(const std::shared_ptr<Mailbox>& mailbox, Request request);
+
+    /**
+     * @brief Hands replies to the event loop
+     * @param done Replies (emptied)
+     */
+    void postReplies(std::vector<Reply>& done);
+
+    /**
+     * @brief Wakes the event loop (async-signal-safe)
+     */
+    void wake() const;
+
+    /**
+     * @brief Accepts every pending client
+     */
+    void acceptClients();
+
+    /**
+     * @brief Reads from a client and queues its complete request lines
+     * @param id Connection id
+     * @param connection Client
+     * @return bool False if the client disconnected
+     */
+    bool readClient(uint64_t id, Connection& connection);
+
+    /**
+     * @brief Sends as much pending output as the socket takes
+     * @param connection Client
+     * @return bool False if the client disconnected
+     */
+    bool flushClient(Connection& connection);
+
+    /**
+     * @brief Moves replies posted by the workers to the client buffers
+     */
+    void deliverReplies();
+
+    /**
+     * @brief Closes a client and drops its sessions
+     * @param id Connection id
+     */
+    void closeClient(uint64_t id);
+
+public:
+    /**
+     * @brief Constructor - binds the socket and starts the pool
+     * @param config Options
+     * @throws std::invalid_argument if the socket path is too long
+     * @throws std::runtime_error if the socket cannot be created
+     */
+    explicit SessionServer(ServerConfig config);
+
+    /**
+     * @brief Destructor - finishes queued requests, closes every client and removes the socket
+     */
+    ~SessionServer();
+
+    SessionServer(const SessionServer&) = delete;
+    SessionServer& operator=(const SessionServer&) = delete;
+
+    /**
+     * @brief Serves clients until stop() is called
+     * @throws std::runtime_error if polling fails
+     */
+    void run();
+
+    /**
+     * @brief Makes run() return (safe to call from a signal handler)
+     */
+    void stop();
+
+    /**
+     * @brief Gets the counters
+     * @return ServerStats Counters so far
+     */
+    ServerStats getStats() const;
+};
+
+#endif //KASYNO_SESSIONSERVER_H
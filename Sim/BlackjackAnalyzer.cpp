@@ -0,0 +1,385 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "BlackjackAnalyzer.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+#include "../Games/Shoe.h"
+
+double BlackjackActionEv::best() const {
+    return std::max({hit, stand, doubleDown, split, surrender});
+}
+
+char BlackjackActionEv::bestMove() const {
+    const double top = best();
+    const bool hitOverStand = hit >= stand;
+
+    if (split == top) return 'P';
+    if (doubleDown == top) return hitOverStand ? 'D' : 'd';
+    if (surrender == top) return hitOverStand ? 'R' : 'r';
+    return hitOverStand ? 'H' : 'S';
+}
+
+BlackjackAnalyzer::BlackjackAnalyzer(int decks): decks(decks) {
+    if (decks < Shoe::MIN_DECKS || decks > Shoe::MAX_DECKS) {
+        throw std::invalid_argument(
+            "BlackjackAnalyzer::BlackjackAnalyzer: deck count (" + std::to_string(decks) + ") must be between " +
+            std::to_string(Shoe::MIN_DECKS) + " and " + std::to_string(Shoe::MAX_DECKS)
+        );
+    }
+
+    // Values 2-9 and Ace have 4 cards per deck, the 10 value has 16 (10, J, Q, K).
+    for (int i = 0; i < VALUE_COUNT; ++i) {
+        shoe[i] = (i + 2 == 10 ? 16 : 4) * decks;
+        shoeSize += shoe[i];
+    }
+}
+
+uint64_t BlackjackAnalyzer::packKey(const Composition& removed, int upCard, int total, bool flag) {
+    // 5 bits per value (a hand never removes more than 31 cards of one value),
+    // then the up card, the total and the flag.
+    uint64_t key = 0;
+    for (int i = 0; i < VALUE_COUNT; ++i) {
+        key |= static_cast<uint64_t>(removed[i]) << (5 * i);
+    }
+    key |= static_cast<uint64_t>(upCard - 2) << 50;
+    key |= static_cast<uint64_t>(total) << 54;
+    key |= static_cast<uint64_t>(flag) << 59;
+    return key;
+}
+
+int BlackjackAnalyzer::cardsLeft(const Composition& removed) const {
+    int left = shoeSize;
+    for (const uint8_t count : removed) left -= count;
+    return left;
+}
+
+void BlackjackAnalyzer::dealerDraw(std::array<int, VALUE_COUNT>& remaining, int left, int total, int cards,
+                                   double probability, BlackjackDealerOdds& odds) {
+    if (left <= 0) return;
+
+    for (int i = 0; i < VALUE_COUNT; ++i) {
+        if (remaining[i] == 0) continue;
+
+        const double p = probability * remaining[i] / left;
+        const int newTotal = total + i + 2;
+
+        if (cards == 1 && newTotal == 21) {
+            odds.blackjack += p;
+        } else if (newTotal > 21) {
+            odds.bust += p;
+        } else if (newTotal >= 17) {
+            odds.stand[newTotal - 17] += p;
+        } else {
+            --remaining[i];
+            dealerDraw(remaining, left - 1, newTotal, cards + 1, p, odds);
+            ++remaining[i];
+        }
+    }
+}
+
+const BlackjackDealerOdds& BlackjackAnalyzer::dealerOdds(const Composition& removed, int upCard) {
+    const uint64_t key = packKey(removed, upCard, 0, false);
+
+    auto it = dealerCache.find(key);
+    if (it != dealerCache.end()) return it->second;
+
+    std::array<int, VALUE_COUNT> remaining{};
+    for (int i = 0; i < VALUE_COUNT; ++i) remaining[i] = shoe[i] - removed[i];
+
+    BlackjackDealerOdds odds;
+    dealerDraw(remaining, cardsLeft(removed), upCard, 1, 1.0, odds);
+
+    return dealerCache.emplace(key, odds).first->second;
+}
+
+double BlackjackAnalyzer::standEv(const Composition& removed, int upCard, int total) {
+    const BlackjackDealerOdds& odds = dealerOdds(removed, upCard);
+
+    // Dealer's two-card 21 beats everything, a dealer bust pays every live hand,
+    // otherwise the hand closer to 21 wins (a player 22 is as close as 20).
+    double ev = odds.bust - odds.blackjack;
+    const int playerRange = std::abs(21 - total);
+
+    for (int i = 0; i < BlackjackDealerOdds::STAND_COUNT; ++i) {
+        const int dealerRange = 21 - (17 + i);
+        if (playerRange < dealerRange) ev += odds.stand[i];
+        else if (playerRange > dealerRange) ev -= odds.stand[i];
+    }
+
+    return ev;
+}
+
+double BlackjackAnalyzer::hitEv(const Composition& removed, int upCard, int total) {
+    if (total + 2 > 21) return -1.0;
+
+    Composition next = removed;
+    const int left = cardsLeft(removed);
+    double ev = 0.0;
+
+    for (int i = 0; i < VALUE_COUNT; ++i) {
+        const int count = shoe[i] - removed[i];
+        if (count == 0) continue;
+
+        const double p = static_cast<double>(count) / left;
+        const int newTotal = total + i + 2;
+
+        if (newTotal > 21) {
+            ev -= p;
+        } else {
+            ++next[i];
+            ev += p * hitStandEv(next, upCard, newTotal);
+            --next[i];
+        }
+    }
+
+    return ev;
+}
+
+double BlackjackAnalyzer::hitStandEv(const Composition& removed, int upCard, int total) {
+    const uint64_t key = packKey(removed, upCard, total, false);
+
+    auto it = playerCache.find(key);
+    if (it != playerCache.end()) return it->second;
+
+    const double ev = std::max(standEv(removed, upCard, total), hitEv(removed, upCard, total));
+    playerCache.emplace(key, ev);
+    return ev;
+}
+
+double BlackjackAnalyzer::doubleEv(const Composition& removed, int upCard, int total) {
+    Composition next = removed;
+    const int left = cardsLeft(removed);
+    double ev = 0.0;
+
+    // The doubled stake is lost on a loss, but a win still pays 2x the original bet only.
+    for (int i = 0; i < VALUE_COUNT; ++i) {
+        const int count = shoe[i] - removed[i];
+        if (count == 0) continue;
+
+        const double p = static_cast<double>(count) / left;
+        const int newTotal = total + i + 2;
+
+        if (newTotal > 21) {
+            ev -= 2.0 * p;
+        } else {
+            ++next[i];
+            ev += p * (standEv(next, upCard, newTotal) - 1.0);
+            --next[i];
+        }
+    }
+
+    return ev;
+}
+
+double BlackjackAnalyzer::chartPlay(const Composition& removed, int upCard, int total) {
+    const char move = chart->totalMove(total, upCard);
+    if (move == 'S' || move == 'd' || move == 'r') {
+        return standEv(removed, upCard, total);
+    }
+
+    if (total + 2 > 21) return -1.0;
+
+    const uint64_t key = packKey(removed, upCard, total, true);
+
+    auto it = playerCache.find(key);
+    if (it != playerCache.end()) return it->second;
+
+    Composition next = removed;
+    const int left = cardsLeft(removed);
+    double ev = 0.0;
+
+    for (int i = 0; i < VALUE_COUNT; ++i) {
+        const int count = shoe[i] - removed[i];
+        if (count == 0) continue;
+
+        const double p = static_cast<double>(count) / left;
+        const int newTotal = total + i + 2;
+
+        if (newTotal > 21) {
+            ev -= p;
+        } else {
+            ++next[i];
+            ev += p * chartPlay(next, upCard, newTotal);
+            --next[i];
+        }
+    }
+
+    playerCache.emplace(key, ev);
+    return ev;
+}
+
+BlackjackActionEv BlackjackAnalyzer::actionEvs(const Composition& removed, int upCard, int total,
+                                               int pairValue, bool restricted) {
+    BlackjackActionEv ev;
+    ev.stand = standEv(removed, upCard, total);
+    ev.hit = hitEv(removed, upCard, total);
+
+    if (!restricted) {
+        ev.doubleDown = doubleEv(removed, upCard, total);
+        ev.surrender = -0.5;
+
+        if (pairValue > 0) {
+            ev.split = splitEv(removed, upCard, pairValue, false);
+        }
+    }
+
+    return ev;
+}
+
+double BlackjackAnalyzer::splitEv(const Composition& removed, int upCard, int pairValue, bool followChart) {
+    Composition next = removed;
+    const int left = cardsLeft(removed);
+    double first = 0.0;
+    double second = 0.0;
+
+    for (int i = 0; i < VALUE_COUNT; ++i) {
+        const int count = shoe[i] - removed[i];
+        if (count == 0) continue;
+
+        const double p = static_cast<double>(count) / left;
+        const int total = pairValue + i + 2;
+
+        ++next[i];
+        if (followChart) {
+            first += p * chartFirstAction(next, upCard, total, 0, true);
+            second += p * chartFirstAction(next, upCard, total, 0, false);
+        } else {
+            first += p * hitStandEv(next, upCard, total);
+            second += p * actionEvs(next, upCard, total, 0, false).best();
+        }
+        --next[i];
+    }
+
+    return first + second;
+}
+
+double BlackjackAnalyzer::chartFirstAction(const Composition& removed, int upCard, int total,
+                                           int pairValue, bool restricted) {
+    if (pairValue > 0 && !restricted && chart->shouldSplit(pairValue, upCard)) {
+        return splitEv(removed, upCard, pairValue, true);
+    }
+
+    switch (chart->totalMove(total, upCard)) {
+        case 'D':
+            return restricted ? chartPlay(removed, upCard, total) : doubleEv(removed, upCard, total);
+        case 'd':
+            return restricted ? standEv(removed, upCard, total) : doubleEv(removed, upCard, total);
+        case 'R':
+            return restricted ? chartPlay(removed, upCard, total) : -0.5;
+        case 'r':
+            return restricted ? standEv(removed, upCard, total) : -0.5;
+        default:
+            return chartPlay(removed, upCard, total);
+    }
+}
+
+BlackjackAnalysis BlackjackAnalyzer::analyze() {
+    using Table = BlackjackStrategyTable;
+
+    BlackjackAnalysis analysis;
+    analysis.decks = decks;
+
+    std::array<std::array<double, Table::UP_CARD_COUNT>, Table::TOTAL_COUNT> weights{};
+    std::array<std::array<BlackjackActionEv, Table::UP_CARD_COUNT>, Table::TOTAL_COUNT> sums{};
+    for (auto& row : sums) {
+        for (auto& cell : row) {
+            cell.hit = cell.stand = cell.doubleDown = cell.surrender = 0.0;
+        }
+    }
+
+    const double n = shoeSize;
+
+    // Visits every initial deal (two player cards, dealer up card) with its probability.
+    // The player's cards are unordered, so two different values count twice.
+    auto forEachDeal = [&](auto&& visit) {
+        for (int a = 0; a < VALUE_COUNT; ++a) {
+            for (int b = a; b < VALUE_COUNT; ++b) {
+                for (int u = 0; u < VALUE_COUNT; ++u) {
+                    const double pa = shoe[a] / n;
+                    const double pb = (shoe[b] - (a == b)) / (n - 1);
+                    const double pu = (shoe[u] - (u == a) - (u == b)) / (n - 2);
+                    const double p = pa * pb * pu * (a == b ? 1.0 : 2.0);
+                    if (p <= 0.0) continue;
+
+                    Composition removed{};
+                    ++removed[a];
+                    ++removed[b];
+                    ++removed[u];
+
+                    visit(removed, a + 2, b + 2, u + 2, p);
+                }
+            }
+        }
+    };
+
+    forEachDeal([&](const Composition& removed, int first, int second, int upCard, double p) {
+        const int total = first + second;
+        if (total == 21) {
+            analysis.optimalEv += 1.5 * p;
+            return;
+        }
+
+        const int pairValue = (first == second) ? first : 0;
+        const BlackjackActionEv ev = actionEvs(removed, upCard, total, pairValue, false);
+        analysis.optimalEv += ev.best() * p;
+
+        BlackjackActionEv& sum = sums[total - Table::MIN_TOTAL][upCard - Table::MIN_UP_CARD];
+        sum.hit += ev.hit * p;
+        sum.stand += ev.stand * p;
+        sum.doubleDown += ev.doubleDown * p;
+        sum.surrender += ev.surrender * p;
+        weights[total - Table::MIN_TOTAL][upCard - Table::MIN_UP_CARD] += p;
+
+        if (pairValue > 0) {
+            analysis.pairs[pairValue - Table::MIN_UP_CARD][upCard - Table::MIN_UP_CARD] = ev;
+        }
+    });
+
+    for (int row = 0; row < Table::TOTAL_COUNT; ++row) {
+        for (int up = 0; up < Table::UP_CARD_COUNT; ++up) {
+            const double weight = weights[row][up];
+            if (weight <= 0.0) {
+                // Only reachable after hitting (21): never worth another card.
+                analysis.chart.totals[row][up] = 'S';
+                continue;
+            }
+
+            BlackjackActionEv& cell = analysis.totals[row][up];
+            cell.hit = sums[row][up].hit / weight;
+            cell.stand = sums[row][up].stand / weight;
+            cell.doubleDown = sums[row][up].doubleDown / weight;
+            cell.surrender = sums[row][up].surrender / weight;
+            analysis.chart.totals[row][up] = cell.bestMove();
+        }
+    }
+
+    for (int row = 0; row < Table::PAIR_COUNT; ++row) {
+        for (int up = 0; up < Table::UP_CARD_COUNT; ++up) {
+            const BlackjackActionEv& cell = analysis.pairs[row][up];
+            analysis.chart.pairs[row][up] = cell.bestMove() == 'P' ? 'P' : '-';
+        }
+    }
+
+    chart = &analysis.chart;
+    forEachDeal([&](const Composition& removed, int first, int second, int upCard, double p) {
+        const int total = first + second;
+        if (total == 21) {
+            analysis.chartEv += 1.5 * p;
+            return;
+        }
+
+        const int pairValue = (first == second) ? first : 0;
+        analysis.chartEv += chartFirstAction(removed, upCard, total, pairValue, false) * p;
+    });
+    chart = nullptr;
+
+    analysis.dealerStates = dealerCache.size();
+    analysis.playerStates = playerCache.size();
+    return analysis;
+}
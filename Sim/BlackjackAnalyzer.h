@@ -0,0 +1,238 @@
+/**
+ * @file BlackjackAnalyzer.h
+ * @brief Combinatorial expected value and strategy solver for the blackjack rules
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_BLACKJACKANALYZER_H
+#define KASYNO_BLACKJACKANALYZER_H
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+
+#include "../Games/BlackjackPolicy.h"
+
+/**
+ * @struct BlackjackDealerOdds
+ * @brief Distribution of the dealer's final hand
+ */
+struct BlackjackDealerOdds {
+    static constexpr int STAND_COUNT = 5;  ///< Standing totals 17-21
+
+    std::array<double, STAND_COUNT> stand{};  ///< Probability of standing on 17 + i
+    double bust = 0.0;                        ///< Probability of going over 21
+    double blackjack = 0.0;                   ///< Probability of a two-card 21
+};
+
+/**
+ * @struct BlackjackActionEv
+ * @brief Expected net win of each first action, per unit of the original bet
+ *
+ * Actions that are not available hold NOT_AVAILABLE.
+ */
+struct BlackjackActionEv {
+    static constexpr double NOT_AVAILABLE = -1e9;  ///< Marker for unavailable actions
+
+    double hit = NOT_AVAILABLE;         ///< Hit, then play on optimally
+    double stand = NOT_AVAILABLE;       ///< Stand
+    double doubleDown = NOT_AVAILABLE;  ///< Double down (pays 2x the original bet only)
+    double split = NOT_AVAILABLE;       ///< Split (pairs only)
+    double surrender = NOT_AVAILABLE;   ///< Surrender
+
+    /**
+     * @brief Gets the best expected value
+     * @return double Highest EV among available actions
+     */
+    double best() const;
+
+    /**
+     * @brief Gets the best action as a strategy chart letter
+     * @return char H, S, D, d, R, r or P (see BlackjackStrategyTable)
+     */
+    char bestMove() const;
+};
+
+/**
+ * @struct BlackjackAnalysis
+ * @brief Result of a full analysis of one shoe size
+ */
+struct BlackjackAnalysis {
+    int decks = 0;                   ///< Decks in the shoe
+    double optimalEv = 0.0;          ///< Player EV per round, composition-dependent optimal play
+    double chartEv = 0.0;            ///< Player EV per round when following the chart
+    BlackjackStrategyTable chart;    ///< Optimal total-dependent strategy chart
+    std::array<std::array<BlackjackActionEv, BlackjackStrategyTable::UP_CARD_COUNT>,
+               BlackjackStrategyTable::TOTAL_COUNT> totals{};  ///< Weighted action EVs by total and up card
+    std::array<std::array<BlackjackActionEv, BlackjackStrategyTable::UP_CARD_COUNT>,
+               BlackjackStrategyTable::PAIR_COUNT> pairs{};    ///< Action EVs by pair and up card
+    size_t dealerStates = 0;         ///< Dealer distributions computed (cache size)
+    size_t playerStates = 0;         ///< Player states evaluated (cache size)
+};
+
+/**
+ * @class BlackjackAnalyzer
+ * @brief Exact expected values for BlackjackEngine rules over a finite shoe
+ *
+ * Every probability is taken over the exact remaining shoe composition.
+ * Dealer outcome distributions and player hit/stand values are memoized
+ * by the multiset of removed cards, which is packed into a 64-bit key
+ * (Ace always counts 11, so card values 2-11 fully describe a hand).
+ *
+ * Split hands are approximated the usual way: each hand is valued on the
+ * shoe without the pair, ignoring the cards the other hand draws, and no
+ * resplitting. The first split hand can only hit or stand, the second one
+ * can also double or surrender, as in BlackjackEngine.
+ */
+class BlackjackAnalyzer {
+public:
+    static constexpr int VALUE_COUNT = 10;  ///< Card values 2-11
+
+    /**
+     * @brief Cards removed from the shoe, count per value (index = value - 2)
+     */
+    using Composition = std::array<uint8_t, VALUE_COUNT>;
+
+private:
+    int decks;                                              ///< Decks in the shoe
+    std::array<int, VALUE_COUNT> shoe{};                    ///< Full shoe, count per value
+    int shoeSize = 0;                                       ///< Cards in the full shoe
+    std::unordered_map<uint64_t, BlackjackDealerOdds> dealerCache;  ///< Dealer odds by removed cards + up card
+    std::unordered_map<uint64_t, double> playerCache;       ///< Hit/stand values by removed cards + up card + total
+    const BlackjackStrategyTable* chart = nullptr;          ///< Chart followed by chartPlay()
+
+    /**
+     * @brief Packs a composition and extra fields into a cache key
+     * @param removed Removed cards
+     * @param upCard Dealer up card value
+     * @param total Player total (0 for dealer keys)
+     * @param flag Extra key bit
+     * @return uint64_t Key
+     */
+    static uint64_t packKey(const Composition& removed, int upCard, int total, bool flag);
+
+    /**
+     * @brief Accumulates the dealer's outcomes by drawing from the remaining shoe
+     * @param remaining Remaining cards per value (modified and restored)
+     * @param left Remaining card count
+     * @param total Dealer total so far
+     * @param cards Cards in the dealer's hand
+     * @param probability Probability of reaching this state
+     * @param odds Output distribution
+     */
+    static void dealerDraw(std::array<int, VALUE_COUNT>& remaining, int left, int total, int cards,
+                           double probability, BlackjackDealerOdds& odds);
+
+    /**
+     * @brief Gets the number of cards left after a removal
+     * @param removed Removed cards
+     * @return int Cards left
+     */
+    int cardsLeft(const Composition& removed) const;
+
+    /**
+     * @brief EV of standing on a total
+     * @param removed Removed cards (player's, dealer's up card and any others)
+     * @param upCard Dealer up card value
+     * @param total Player total
+     * @return double Expected net win
+     */
+    double standEv(const Composition& removed, int upCard, int total);
+
+    /**
+     * @brief EV of taking one card, then playing hit/stand optimally
+     * @param removed Removed cards
+     * @param upCard Dealer up card value
+     * @param total Player total
+     * @return double Expected net win
+     */
+    double hitEv(const Composition& removed, int upCard, int total);
+
+    /**
+     * @brief Best of hit and stand (memoized)
+     * @param removed Removed cards
+     * @param upCard Dealer up card value
+     * @param total Player total
+     * @return double Expected net win
+     */
+    double hitStandEv(const Composition& removed, int upCard, int total);
+
+    /**
+     * @brief EV of doubling down
+     * @param removed Removed cards
+     * @param upCard Dealer up card value
+     * @param total Player total
+     * @return double Expected net win per original bet
+     */
+    double doubleEv(const Composition& removed, int upCard, int total);
+
+    /**
+     * @brief EV of hit/stand play following the chart (memoized)
+     * @param removed Removed cards
+     * @param upCard Dealer up card value
+     * @param total Player total
+     * @return double Expected net win
+     */
+    double chartPlay(const Composition& removed, int upCard, int total);
+
+    /**
+     * @brief EV of all first actions of a hand
+     * @param removed Removed cards
+     * @param upCard Dealer up card value
+     * @param total Player total
+     * @param pairValue Value of the pair, 0 if the hand cannot split
+     * @param restricted Only hit and stand allowed (first hand after a split)
+     * @return BlackjackActionEv Action values
+     */
+    BlackjackActionEv actionEvs(const Composition& removed, int upCard, int total, int pairValue, bool restricted);
+
+    /**
+     * @brief EV of splitting a pair (both split hands together)
+     * @param removed Removed cards, both pair cards included
+     * @param upCard Dealer up card value
+     * @param pairValue Value of each pair card
+     * @param followChart Play the split hands by the chart instead of optimally
+     * @return double Expected net win per original bet
+     */
+    double splitEv(const Composition& removed, int upCard, int pairValue, bool followChart);
+
+    /**
+     * @brief EV of the chart's first action for a hand
+     * @param removed Removed cards
+     * @param upCard Dealer up card value
+     * @param total Player total
+     * @param pairValue Value of the pair, 0 if the hand cannot split
+     * @param restricted Only hit and stand allowed
+     * @return double Expected net win
+     */
+    double chartFirstAction(const Composition& removed, int upCard, int total, int pairValue, bool restricted);
+
+public:
+    /**
+     * @brief Constructor
+     * @param decks Number of decks in the shoe (1-8)
+     * @throws std::invalid_argument if decks are out of range
+     */
+    explicit BlackjackAnalyzer(int decks);
+
+    /**
+     * @brief Dealer outcome distribution for a shoe with cards removed
+     * @param removed Removed cards, the dealer's up card included
+     * @param upCard Dealer up card value (2-11)
+     * @return const BlackjackDealerOdds& Distribution (cached)
+     */
+    const BlackjackDealerOdds& dealerOdds(const Composition& removed, int upCard);
+
+    /**
+     * @brief Runs the full analysis: every initial deal, optimal chart and house edge
+     * @return BlackjackAnalysis Results
+     */
+    BlackjackAnalysis analyze();
+};
+
+#endif //KASYNO_BLACKJACKANALYZER_H
@@ -0,0 +1,205 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "BlackjackSimulator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../TaskPool.h"
+
+void BlackjackSimStats::merge(const BlackjackSimStats& other) {
+    rounds += other.rounds;
+    hands += other.hands;
+    handsWon += other.handsWon;
+    handsPushed += other.handsPushed;
+    handsLost += other.handsLost;
+    wagered += other.wagered;
+    net += other.net;
+    netSquared += other.netSquared;
+    for (int i = 0; i < BlackjackRoundResult::ACTION_COUNT; ++i) actions[i] += other.actions[i];
+    for (int i = 0; i < END_COUNT; ++i) ends[i] += other.ends[i];
+
+    sessions += other.sessions;
+    ruined += other.ruined;
+    checkpoints = std::max(checkpoints, other.checkpoints);
+    trajectories.insert(trajectories.end(), other.trajectories.begin(), other.trajectories.end());
+}
+
+double BlackjackSimStats::houseEdge(int bet) const {
+    if (rounds == 0 || bet <= 0) return 0.0;
+    return -static_cast<double>(net) / (static_cast<double>(rounds) * bet);
+}
+
+double BlackjackSimStats::houseEdgePerWager() const {
+    if (wagered == 0) return 0.0;
+    return -static_cast<double>(net) / static_cast<double>(wagered);
+}
+
+double BlackjackSimStats::houseEdgeMargin(int bet, double z) const {
+    if (rounds < 2 || bet <= 0) return 0.0;
+
+    const double n = static_cast<double>(rounds);
+    const double mean = static_cast<double>(net) / n;
+    const double meanSquare = netSquared / n;
+    const double variance = (meanSquare - mean * mean) * n / (n - 1.0);
+
+    return z * std::sqrt(variance / n) / bet;
+}
+
+uint64_t BlackjackSimStats::totalActions() const {
+    uint64_t total = 0;
+    for (const uint64_t count : actions) total += count;
+    return total;
+}
+
+int64_t BlackjackSimStats::bankrollPercentile(int checkpoint, double fraction) const {
+    if (sessions == 0 || checkpoint < 0 || checkpoint >= checkpoints) return 0;
+
+    std::vector<int64_t> samples;
+    samples.reserve(sessions);
+    for (uint64_t s = 0; s < sessions; ++s) {
+        samples.push_back(trajectories[s * checkpoints + checkpoint]);
+    }
+
+    const size_t rank = std::min(samples.size() - 1,
+                                 static_cast<size_t>(fraction * static_cast<double>(samples.size())));
+    std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(rank), samples.end());
+    return samples[rank];
+}
+
+double BlackjackSimStats::bankrollMean(int checkpoint) const {
+    if (sessions == 0 || checkpoint < 0 || checkpoint >= checkpoints) return 0.0;
+
+    double total = 0.0;
+    for (uint64_t s = 0; s < sessions; ++s) {
+        total += static_cast<double>(trajectories[s * checkpoints + checkpoint]);
+    }
+    return total / static_cast<double>(sessions);
+}
+
+double BlackjackSimStats::ruinedFraction(int checkpoint, int bet) const {
+    if (sessions == 0 || checkpoint < 0 || checkpoint >= checkpoints) return 0.0;
+
+    uint64_t count = 0;
+    for (uint64_t s = 0; s < sessions; ++s) {
+        if (trajectories[s * checkpoints + checkpoint] < bet) ++count;
+    }
+    return static_cast<double>(count) / static_cast<double>(sessions);
+}
+
+BlackjackSimStats BlackjackSimulator::runShard(uint64_t sessions, const BlackjackSimConfig& config, Rng& rng) {
+    BlackjackEngine engine(rng, config.decks, config.penetration);
+    BasicStrategyPolicy policy(config.strategy ? *config.strategy : BlackjackStrategyTable::standard());
+
+    const int checkpoints = static_cast<int>(
+        std::min<uint64_t>(static_cast<uint64_t>(config.checkpoints), config.sessionRounds)
+    );
+
+    BlackjackSimStats stats;
+    stats.sessions = sessions;
+    stats.checkpoints = checkpoints;
+    stats.trajectories.reserve(sessions * checkpoints);
+
+    for (uint64_t s = 0; s < sessions; ++s) {
+        // int64_t: a winning session can outgrow the int bankroll and bet
+        int64_t balance = config.bankroll;
+        int checkpoint = 0;
+        uint64_t nextCheckpoint = config.sessionRounds / checkpoints;
+
+        for (uint64_t round = 1; round <= config.sessionRounds; ++round) {
+            if (balance < config.bet) {
+                ++stats.ruined;
+                break;
+            }
+
+            balance -= config.bet;
+            const int available = static_cast<int>(std::min<int64_t>(balance, std::numeric_limits<int>::max()));
+            const BlackjackRoundResult result = engine.playRound(config.bet, available, policy);
+            balance += result.payout(config.bet) - result.extraStake + result.refund;
+
+            const int64_t net = result.net(config.bet);
+            ++stats.rounds;
+            stats.hands += result.hands;
+            stats.handsWon += result.handsWon;
+            stats.handsPushed += result.handsPushed;
+            stats.handsLost += result.handsLost;
+            stats.wagered += static_cast<uint64_t>(config.bet) + static_cast<uint64_t>(result.extraStake);
+            stats.net += net;
+            stats.netSquared += static_cast<double>(net) * static_cast<double>(net);
+            for (int i = 0; i < BlackjackRoundResult::ACTION_COUNT; ++i) stats.actions[i] += result.actions[i];
+            ++stats.ends[static_cast<int>(result.end)];
+
+            if (round == nextCheckpoint) {
+                stats.trajectories.push_back(balance);
+                ++checkpoint;
+                nextCheckpoint = config.sessionRounds * (checkpoint + 1) / checkpoints;
+            }
+        }
+
+        // A ruined session keeps its last bankroll for the remaining checkpoints.
+        for (; checkpoint < checkpoints; ++checkpoint) {
+            stats.trajectories.push_back(balance);
+        }
+    }
+
+    return stats;
+}
+
+BlackjackSimStats BlackjackSimulator::run(const BlackjackSimConfig& settings) {
+    BlackjackSimConfig config = settings;
+
+    if (config.bet <= 0 || config.bankroll < config.bet) {
+        throw std::invalid_argument(
+            "BlackjackSimulator::run: bet (" + std::to_string(config.bet) + ") must be positive and not exceed bankroll (" +
+            std::to_string(config.bankroll) + ")"
+        );
+    }
+
+    if (config.rounds == 0 || config.sessionRounds == 0 || config.checkpoints <= 0) {
+        throw std::invalid_argument("BlackjackSimulator::run: rounds, session rounds and checkpoints must be positive");
+    }
+
+    // Validates the shoe settings before any worker starts.
+    Shoe(config.decks, config.penetration);
+
+    config.sessionRounds = std::min(config.sessionRounds, config.rounds);
+    if (config.rounds % config.sessionRounds != 0) {
+        // A shorter last session would skew the checkpoint statistics
+        throw std::invalid_argument(
+            "BlackjackSimulator::run: rounds (" + std::to_string(config.rounds) +
+            ") must be a multiple of session rounds (" + std::to_string(config.sessionRounds) + ")"
+        );
+    }
+    const uint64_t sessions = config.rounds / config.sessionRounds;
+
+    const uint64_t shards = (sessions + SHARD_SESSIONS - 1) / SHARD_SESSIONS;
+
+    // Shard k plays its own shoe from stream k, whatever thread runs it
+    std::vector<Rng> streams;
+    streams.reserve(shards);
+    Rng cursor = Rng::forStream(config.seed, 0);
+    for (uint64_t k = 0; k < shards; ++k) {
+        streams.push_back(cursor.split());
+    }
+
+    // Sessions end early on ruin, so shard costs differ; idle workers steal
+    std::vector<BlackjackSimStats> results(shards);
+    TaskPool pool(config.threads);
+    pool.parallelFor(shards, [&](size_t k) {
+        const uint64_t shardSessions = std::min<uint64_t>(SHARD_SESSIONS, sessions - k * SHARD_SESSIONS);
+        results[k] = runShard(shardSessions, config, streams[k]);
+    });
+
+    BlackjackSimStats total;
+    for (const auto& result : results) {
+        total.merge(result);
+    }
+
+    return total;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file BlackjackSimulator.h
+ * @brief Headless multi-threaded Monte Carlo simulator for blackjack
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_BLACKJACKSIMULATOR_H
+#define KASYNO_BLACKJACKSIMULATOR_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "../Games/BlackjackEngine.h"
+
+/**
+ * @struct BlackjackSimConfig
+ * @brief Parameters of a simulation run
+ *
+ * Rounds are played in sessions: each session starts with the same
+ * bankroll and flat-bets until sessionRounds rounds are played or the
+ * bankroll cannot cover the bet (ruin).
+ */
+struct BlackjackSimConfig {
+    uint64_t rounds = 1'000'000;      ///< Round budget of the whole run (a multiple of sessionRounds)
+    unsigned threads = 0;             ///< Worker count (0 = all hardware threads)
+    uint64_t seed = 0;                ///< Master seed, every shard derives its own stream
+    int decks = 6;                    ///< Decks in the shoe
+    double penetration = 0.75;        ///< Fraction of the shoe dealt before reshuffling
+    int bet = 10;                     ///< Flat bet per round
+    int bankroll = 1000;              ///< Starting bankroll of every session
+    uint64_t sessionRounds = 1000;    ///< Rounds per session
+    int checkpoints = 10;             ///< Bankroll samples per session
+    const BlackjackStrategyTable* strategy = nullptr;  ///< Chart to play (nullptr = standard chart)
+};
+
+/**
+ * @struct BlackjackSimStats
+ * @brief Aggregated results of a simulation run
+ */
+struct BlackjackSimStats {
+    static constexpr int END_COUNT = 5;  ///< Number of BlackjackRoundEnd values
+
+    uint64_t rounds = 0;                                               ///< Rounds played
+    uint64_t hands = 0;                                                ///< Hands played (splits included)
+    uint64_t handsWon = 0;                                             ///< Hands won
+    uint64_t handsPushed = 0;                                          ///< Hands pushed
+    uint64_t handsLost = 0;                                            ///< Hands lost
+    uint64_t wagered = 0;                                              ///< Money staked, doubles and splits included
+    int64_t net = 0;                                                   ///< Player's net win
+    double netSquared = 0.0;                                           ///< Sum of squared per-round net wins
+    std::array<uint64_t, BlackjackRoundResult::ACTION_COUNT> actions{}; ///< Accepted actions by type
+    std::array<uint64_t, END_COUNT> ends{};                            ///< Rounds by BlackjackRoundEnd
+
+    uint64_t sessions = 0;                ///< Sessions played
+    uint64_t ruined = 0;                  ///< Sessions that ran out of money
+    int checkpoints = 0;                  ///< Bankroll samples per session
+    std::vector<int64_t> trajectories;    ///< Bankroll samples, checkpoints values per session
+
+    /**
+     * @brief Adds results of another run
+     * @param other Stats to merge in
+     */
+    void merge(const BlackjackSimStats& other);
+
+    /**
+     * @brief House edge per initial bet
+     * @param bet Flat bet used in the run
+     * @return double Edge as a fraction (0.01 = 1%)
+     */
+    double houseEdge(int bet) const;
+
+    /**
+     * @brief House edge per money actually staked (doubles and splits included)
+     * @return double Edge as a fraction
+     */
+    double houseEdgePerWager() const;
+
+    /**
+     * @brief Half-width of the confidence interval for houseEdge()
+     * @param bet Flat bet used in the run
+     * @param z Standard normal quantile (1.96 = 95%)
+     * @return double Half-width
+     */
+    double houseEdgeMargin(int bet, double z = 1.96) const;
+
+    /**
+     * @brief Number of decisions taken
+     * @return uint64_t Decision count
+     */
+    uint64_t totalActions() const;
+
+    /**
+     * @brief Bankroll percentile at a checkpoint across all sessions
+     * @param checkpoint Checkpoint index
+     * @param fraction Percentile (0.5 = median)
+     * @return int64_t Bankroll
+     */
+    int64_t bankrollPercentile(int checkpoint, double fraction) const;
+
+    /**
+     * @brief Mean bankroll at a checkpoint across all sessions
+     * @param checkpoint Checkpoint index
+     * @return double Mean bankroll
+     */
+    double bankrollMean(int checkpoint) const;
+
+    /**
+     * @brief Fraction of sessions that could not cover the bet at a checkpoint
+     * @param checkpoint Checkpoint index
+     * @param bet Flat bet used in the run
+     * @return double Fraction of sessions
+     */
+    double ruinedFraction(int checkpoint, int bet) const;
+};
+
+/**
+ * @class BlackjackSimulator
+ * @brief Runs BlackjackEngine sessions sharded across worker threads
+ *
+ * Sessions are grouped into shards of SHARD_SESSIONS run on a TaskPool.
+ * Shard k plays its own shoe from substream k of the seed, so a run is
+ * reproducible from its seed alone, whatever the thread count.
+ */
+class BlackjackSimulator {
+public:
+    static constexpr uint64_t SHARD_SESSIONS = 16;  ///< Sessions per task
+
+    /**
+     * @brief Simulates a number of sessions on the calling thread
+     * @param sessions Number of sessions
+     * @param config Simulation parameters
+     * @param rng Random number generator to use
+     * @return BlackjackSimStats Shard results
+     */
+    static BlackjackSimStats runShard(uint64_t sessions, const BlackjackSimConfig& config, Rng& rng);
+
+    /**
+     * @brief Runs the full simulation
+     * @param settings Simulation parameters
+     * @return BlackjackSimStats Merged results from all shards
+     * @throws std::invalid_argument if bet, bankroll, shoe or session settings are invalid,
+     *         or rounds is not a multiple of sessionRounds
+     */
+    static BlackjackSimStats run(const BlackjackSimConfig& settings);
+};
+
+#endif //KASYNO_BLACKJACKSIMULATOR_H
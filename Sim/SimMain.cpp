@@ -0,0 +1,366 @@
+/**
+ * @file SimMain.cpp
+ * @brief Entry point of the headless kasyno_sim tool
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "BlackjackAnalyzer.h"
+#include "BlackjackSimulator.h"
+#include "SlotsSimulator.h"
+#include "../Games/SlotsOdds.h"
+#include "../CommandLine.h"
+#include "../LeaderboardBinary.h"
+#include "../Resources/TextRes.h"
+
+/**
+ * @brief Prints command line usage
+ */
+static void printUsage() {
+    std::cout <<
+        "Usage: kasyno_sim <command> [options]\n"
+        "\n"
+        "Commands:\n"
+        "  slots        Monte Carlo simulation of the slot machine\n"
+        "  slots-exact  Exact RTP, variance and volatility of the slots paytable\n"
+        "  blackjack    Monte Carlo simulation of blackjack played by a strategy chart\n"
+        "  blackjack-ev Exact blackjack EV per hand and the optimal strategy chart\n"
+        "  leaderboard-convert  Convert a text leaderboard to the binary format\n"
+        "\n"
+        "Options:\n"
+        "  --spins N           Number of slots spins (default: 1000000)\n"
+        "  --rounds N          Number of blackjack rounds (default: 1000000)\n"
+        "  --threads N         Worker threads (default: all hardware threads)\n"
+        "  --seed N            Master seed (default: random)\n"
+        "  --decks N           Decks in the blackjack shoe (default: 6)\n"
+        "  --penetration X     Part of the shoe dealt before reshuffling (default: 0.75)\n"
+        "  --bet N             Flat blackjack bet (default: 10)\n"
+        "  --bankroll N        Starting bankroll of every session (default: 1000)\n"
+        "  --session-rounds N  Rounds per blackjack session, must divide --rounds (default: 1000)\n"
+        "  --strategy NAME     Blackjack chart: standard or optimal (default: standard)\n"
+        "  --input FILE        Text leaderboard to convert (default: leaderboard.txt)\n"
+        "  --output FILE       Binary leaderboard to write (default: leaderboard.bin)\n";
+}
+
+/**
+ * @brief Runs the slots simulation and prints a report
+ * @param config Simulation parameters
+ */
+static void runSlots(const SlotsSimConfig& config) {
+    const auto start = std::chrono::steady_clock::now();
+    const SlotsSimStats stats = SlotsSimulator::run(config);
+    const auto end = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+
+    std::printf("=== SLOTS SIMULATION ===\n");
+    std::printf("Seed:            %llu\n", static_cast<unsigned long long>(config.seed));
+    std::printf("Spins:           %llu\n", static_cast<unsigned long long>(stats.spins));
+    std::printf("Time:            %.3f s (%.1f M spins/s)\n",
+                seconds, seconds > 0.0 ? stats.spins / seconds / 1e6 : 0.0);
+    std::printf("\n");
+    std::printf("RTP:             %.6f%% +/- %.6f%% (95%% CI)\n",
+                stats.rtp() * 100.0, stats.rtpMargin() * 100.0);
+    std::printf("Exact RTP:       %.6f%% (deviation %+.2f sigma)\n",
+                SLOTS_EXACT_ODDS.rtp() * 100.0,
+                stats.rtpMargin() > 0.0
+                    ? (stats.rtp() - SLOTS_EXACT_ODDS.rtp()) / (stats.rtpMargin() / 1.96)
+                    : 0.0);
+    std::printf("Hit frequency:   %.6f%% +/- %.6f%% (95%% CI)\n",
+                stats.hitFrequency() * 100.0, stats.hitFrequencyMargin() * 100.0);
+    std::printf("Variance:        %.6f\n", stats.variance());
+    std::printf("Std deviation:   %.6f\n", std::sqrt(stats.variance()));
+    std::printf("\n");
+    std::printf("%-8s %16s %12s %16s %12s\n", "Symbol", "Triples", "Freq", "Pairs", "Freq");
+
+    const double n = stats.spins > 0 ? static_cast<double>(stats.spins) : 1.0;
+    for (int i = 0; i < SlotsRules::SYMBOL_COUNT; ++i) {
+        std::printf("%-8s %16llu %11.6f%% %16llu %11.6f%%\n",
+                    TextRes::SLOT_SYMBOL_NAMES[i].c_str(),
+                    static_cast<unsigned long long>(stats.triples[i]), stats.triples[i] / n * 100.0,
+                    static_cast<unsigned long long>(stats.pairs[i]), stats.pairs[i] / n * 100.0);
+    }
+}
+
+/**
+ * @brief Prints the exact odds of the slots paytable
+ */
+static void runSlotsExact() {
+    const SlotsOdds& odds = SLOTS_EXACT_ODDS;
+    static constexpr int BET_LEVELS[] = {1, 10, 20, 50, 100, 200, 500};
+
+    std::printf("=== SLOTS EXACT ODDS ===\n");
+    std::printf("Outcome space:   %llu weighted combinations\n",
+                static_cast<unsigned long long>(odds.totalWeight));
+    std::printf("RTP:             %.6f%%\n", odds.rtp() * 100.0);
+    std::printf("House edge:      %.6f%%\n", (1.0 - odds.rtp()) * 100.0);
+    std::printf("Hit frequency:   %.6f%%\n", odds.hitFrequency() * 100.0);
+    std::printf("\n");
+    std::printf("%8s %14s %14s %16s %14s\n", "Bet", "Exp. return", "Exp. value", "Variance", "Volatility");
+
+    for (int bet : BET_LEVELS) {
+        std::printf("%8d %14.4f %14.4f %16.4f %14.4f\n",
+                    bet, odds.expectedReturn(bet), odds.expectedValue(bet),
+                    odds.variance(bet), odds.volatilityIndex(bet));
+    }
+
+    std::printf("\n");
+    std::printf("%-8s %14s %14s\n", "Symbol", "P(triple)", "P(pair)");
+
+    const double total = static_cast<double>(odds.totalWeight);
+    for (int i = 0; i < SlotsRules::SYMBOL_COUNT; ++i) {
+        std::printf("%-8s %13.6f%% %13.6f%%\n",
+                    TextRes::SLOT_SYMBOL_NAMES[i].c_str(),
+                    odds.tripleWeight[i] / total * 100.0,
+                    odds.pairWeight[i] / total * 100.0);
+    }
+}
+
+/**
+ * @brief Runs the blackjack simulation and prints a report
+ * @param config Simulation parameters
+ */
+static void runBlackjack(const BlackjackSimConfig& config) {
+    static constexpr const char* ACTION_NAMES[] = {"Hit", "Stand", "Double down", "Split", "Surrender"};
+    static constexpr const char* END_NAMES[] = {
+        "Player blackjack", "All hands dead", "Dealer blackjack", "Dealer bust", "Showdown"
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    const BlackjackSimStats stats = BlackjackSimulator::run(config);
+    const auto end = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    const double rounds = stats.rounds > 0 ? static_cast<double>(stats.rounds) : 1.0;
+    const double hands = stats.hands > 0 ? static_cast<double>(stats.hands) : 1.0;
+
+    std::printf("=== BLACKJACK SIMULATION ===\n");
+    std::printf("Seed:            %llu\n", static_cast<unsigned long long>(config.seed));
+    std::printf("Shoe:            %d decks, %.0f%% penetration\n", config.decks, config.penetration * 100.0);
+    std::printf("Rounds:          %llu (%llu hands)\n",
+                static_cast<unsigned long long>(stats.rounds), static_cast<unsigned long long>(stats.hands));
+    std::printf("Time:            %.3f s (%.1f M rounds/s)\n",
+                seconds, seconds > 0.0 ? stats.rounds / seconds / 1e6 : 0.0);
+    std::printf("\n");
+    std::printf("House edge:      %.4f%% +/- %.4f%% of the initial bet (95%% CI)\n",
+                stats.houseEdge(config.bet) * 100.0, stats.houseEdgeMargin(config.bet) * 100.0);
+    std::printf("Per stake:       %.4f%% (doubles and splits included)\n", stats.houseEdgePerWager() * 100.0);
+    std::printf("Hands won:       %.4f%%\n", stats.handsWon / hands * 100.0);
+    std::printf("Hands pushed:    %.4f%%\n", stats.handsPushed / hands * 100.0);
+    std::printf("Hands lost:      %.4f%%\n", stats.handsLost / hands * 100.0);
+    std::printf("\n");
+
+    const double actions = stats.totalActions() > 0 ? static_cast<double>(stats.totalActions()) : 1.0;
+    std::printf("%-18s %16s %12s %12s\n", "Action", "Count", "Of actions", "Per round");
+    for (int i = 0; i < BlackjackRoundResult::ACTION_COUNT; ++i) {
+        std::printf("%-18s %16llu %11.4f%% %12.4f\n", ACTION_NAMES[i],
+                    static_cast<unsigned long long>(stats.actions[i]),
+                    stats.actions[i] / actions * 100.0, stats.actions[i] / rounds);
+    }
+    std::printf("\n");
+
+    std::printf("%-18s %16s %12s\n", "Round end", "Count", "Freq");
+    for (int i = 0; i < BlackjackSimStats::END_COUNT; ++i) {
+        std::printf("%-18s %16llu %11.4f%%\n", END_NAMES[i],
+                    static_cast<unsigned long long>(stats.ends[i]), stats.ends[i] / rounds * 100.0);
+    }
+    std::printf("\n");
+
+    std::printf("Bankroll: %llu sessions, %d start, %d flat bet, %llu ruined (%.4f%%)\n",
+                static_cast<unsigned long long>(stats.sessions), config.bankroll, config.bet,
+                static_cast<unsigned long long>(stats.ruined),
+                stats.sessions > 0 ? static_cast<double>(stats.ruined) / stats.sessions * 100.0 : 0.0);
+    std::printf("%10s %10s %10s %10s %10s %10s %12s %10s\n",
+                "Round", "P5", "P25", "Median", "P75", "P95", "Mean", "Ruined");
+
+    const uint64_t sessionRounds = std::min(config.sessionRounds, config.rounds);
+    for (int c = 0; c < stats.checkpoints; ++c) {
+        std::printf("%10llu %10lld %10lld %10lld %10lld %10lld %12.2f %9.4f%%\n",
+                    static_cast<unsigned long long>(sessionRounds * (c + 1) / stats.checkpoints),
+                    static_cast<long long>(stats.bankrollPercentile(c, 0.05)),
+                    static_cast<long long>(stats.bankrollPercentile(c, 0.25)),
+                    static_cast<long long>(stats.bankrollPercentile(c, 0.50)),
+                    static_cast<long long>(stats.bankrollPercentile(c, 0.75)),
+                    static_cast<long long>(stats.bankrollPercentile(c, 0.95)), stats.bankrollMean(c),
+                    stats.ruinedFraction(c, config.bet) * 100.0);
+    }
+}
+
+/**
+ * @brief Formats an expected value for the EV table
+ * @param ev Expected value
+ * @return std::string Percentage text or "-" if not available
+ */
+static std::string formatEv(double ev) {
+    if (ev <= BlackjackActionEv::NOT_AVAILABLE) return "-";
+
+    char buffer[16];
+    std::snprintf(buffer, sizeof(buffer), "%+.1f", ev * 100.0);
+    return buffer;
+}
+
+/**
+ * @brief Prints a strategy chart
+ * @param chart Chart to print
+ */
+static void printChart(const BlackjackStrategyTable& chart) {
+    static constexpr const char* UP_CARDS = "     2  3  4  5  6  7  8  9  T  A\n";
+
+    std::printf("Totals (H hit, S stand, D/d double else hit/stand, R/r surrender else hit/stand):\n");
+    std::printf("%s", UP_CARDS);
+    for (int row = 0; row < BlackjackStrategyTable::TOTAL_COUNT; ++row) {
+        std::printf("%3d ", BlackjackStrategyTable::MIN_TOTAL + row);
+        for (const char move : chart.totals[row]) std::printf("  %c", move);
+        std::printf("\n");
+    }
+
+    std::printf("\nPairs (P split):\n");
+    std::printf("%s", UP_CARDS);
+    for (int row = 0; row < BlackjackStrategyTable::PAIR_COUNT; ++row) {
+        const int value = BlackjackStrategyTable::MIN_UP_CARD + row;
+        std::printf("%3s ", value == 11 ? "A-A" : value == 10 ? "T-T" : (std::to_string(value) + "-" + std::to_string(value)).c_str());
+        for (const char move : chart.pairs[row]) std::printf("  %c", move);
+        std::printf("\n");
+    }
+}
+
+/**
+ * @brief Solves the blackjack rules exactly and prints the house edge, chart and EVs
+ * @param decks Decks in the shoe
+ */
+static void runBlackjackEv(int decks) {
+    const auto start = std::chrono::steady_clock::now();
+    BlackjackAnalyzer analyzer(decks);
+    const BlackjackAnalysis analysis = analyzer.analyze();
+    const auto end = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+
+    std::printf("=== BLACKJACK EXACT EV ===\n");
+    std::printf("Shoe:            %d decks (full shoe, no cut card)\n", decks);
+    std::printf("Time:            %.3f s (%zu dealer states, %zu player states)\n",
+                seconds, analysis.dealerStates, analysis.playerStates);
+    std::printf("\n");
+    std::printf("House edge:      %.4f%% (optimal play for every hand composition)\n", -analysis.optimalEv * 100.0);
+    std::printf("Chart edge:      %.4f%% (playing the chart below)\n", -analysis.chartEv * 100.0);
+    std::printf("\n");
+
+    printChart(analysis.chart);
+
+    std::printf("\nEV of the best action in %% of the bet (two-card hands):\n");
+    std::printf("    %7s%7s%7s%7s%7s%7s%7s%7s%7s%7s\n", "2", "3", "4", "5", "6", "7", "8", "9", "T", "A");
+    for (int row = 0; row < BlackjackStrategyTable::TOTAL_COUNT; ++row) {
+        std::printf("%3d ", BlackjackStrategyTable::MIN_TOTAL + row);
+        for (const BlackjackActionEv& cell : analysis.totals[row]) {
+            std::printf("%7s", formatEv(cell.best()).c_str());
+        }
+        std::printf("\n");
+    }
+}
+
+/**
+ * @brief Main entry point of the simulator
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return int Exit code (0 for success)
+ */
+int main(int argc, char** argv) {
+    std::vector<std::string> args(argv + 1, argv + argc);
+
+    if (args.empty() || args[0] == "--help" || args[0] == "-h") {
+        printUsage();
+        return args.empty() ? 1 : 0;
+    }
+
+    try {
+        const std::string command = args[0];
+
+        SlotsSimConfig config;
+        config.seed = (static_cast<uint64_t>(std::random_device{}()) << 32) ^ std::random_device{}();
+
+        BlackjackSimConfig blackjack;
+        std::string strategy = "standard";
+        std::string input = "leaderboard.txt";
+        std::string output = "leaderboard.bin";
+
+        for (size_t i = 1; i < args.size(); ++i) {
+            const std::string& option = args[i];
+            if (i + 1 >= args.size()) {
+                throw std::invalid_argument("Missing value for " + option);
+            }
+            const std::string& value = args[++i];
+
+            if (option == "--spins") {
+                config.spins = CommandLine::parseNumber<uint64_t>(option, value);
+            } else if (option == "--rounds") {
+                blackjack.rounds = CommandLine::parseNumber<uint64_t>(option, value);
+            } else if (option == "--threads") {
+                config.threads = CommandLine::parseNumber<unsigned>(option, value);
+            } else if (option == "--seed") {
+                config.seed = CommandLine::parseNumber<uint64_t>(option, value);
+            } else if (option == "--decks") {
+                blackjack.decks = CommandLine::parseNumber<int>(option, value);
+            } else if (option == "--penetration") {
+                blackjack.penetration = CommandLine::parseDecimal(option, value, 0.0, 1.0);
+            } else if (option == "--bet") {
+                blackjack.bet = CommandLine::parseNumber<int>(option, value);
+            } else if (option == "--bankroll") {
+                blackjack.bankroll = CommandLine::parseNumber<int>(option, value);
+            } else if (option == "--session-rounds") {
+                blackjack.sessionRounds = CommandLine::parseNumber<uint64_t>(option, value);
+            } else if (option == "--strategy") {
+                if (value != "standard" && value != "optimal") {
+                    throw std::invalid_argument("Invalid value for " + option + ": '" + value + "'");
+                }
+                strategy = value;
+            } else if (option == "--input") {
+                input = value;
+            } else if (option == "--output") {
+                output = value;
+            } else {
+                throw std::invalid_argument("Unknown option: " + option);
+            }
+        }
+
+        if (command == "slots") {
+            runSlots(config);
+        } else if (command == "slots-exact") {
+            runSlotsExact();
+        } else if (command == "blackjack") {
+            blackjack.threads = config.threads;
+            blackjack.seed = config.seed;
+
+            BlackjackAnalysis analysis;
+            if (strategy == "optimal") {
+                analysis = BlackjackAnalyzer(blackjack.decks).analyze();
+                blackjack.strategy = &analysis.chart;
+            }
+
+            runBlackjack(blackjack);
+        } else if (command == "blackjack-ev") {
+            runBlackjackEv(blackjack.decks);
+        } else if (command == "leaderboard-convert") {
+            const size_t players = LeaderboardBinary::convertText(input, output);
+            std::cout << "Wrote " << players << " players from " << input << " to " << output << "\n";
+        } else {
+            std::cerr << "Unknown command: " << command << "\n\n";
+            printUsage();
+            return 1;
+        }
+
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
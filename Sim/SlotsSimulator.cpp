@@ -0,0 +1,133 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "SlotsSimulator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../TaskPool.h"
+
+void SlotsSimStats::merge(const SlotsSimStats& other) {
+    spins += other.spins;
+    misses += other.misses;
+    for (int i = 0; i < SlotsRules::SYMBOL_COUNT; ++i) {
+        triples[i] += other.triples[i];
+        pairs[i] += other.pairs[i];
+    }
+}
+
+uint64_t SlotsSimStats::totalReturn() const {
+    uint64_t total = 0;
+    for (int i = 0; i < SlotsRules::SYMBOL_COUNT; ++i) {
+        total += triples[i] * SlotsRules::TRIPLET_PAYOUTS[i];
+        total += pairs[i] * SlotsRules::PAIR_PAYOUTS[i];
+    }
+    return total;
+}
+
+uint64_t SlotsSimStats::totalReturnSquared() const {
+    uint64_t total = 0;
+    for (int i = 0; i < SlotsRules::SYMBOL_COUNT; ++i) {
+        const uint64_t triplet = SlotsRules::TRIPLET_PAYOUTS[i];
+        const uint64_t pair = SlotsRules::PAIR_PAYOUTS[i];
+        total += triples[i] * triplet * triplet;
+        total += pairs[i] * pair * pair;
+    }
+    return total;
+}
+
+double SlotsSimStats::rtp() const {
+    if (spins == 0) return 0.0;
+    return static_cast<double>(totalReturn()) / static_cast<double>(spins);
+}
+
+double SlotsSimStats::hitFrequency() const {
+    if (spins == 0) return 0.0;
+    return static_cast<double>(spins - misses) / static_cast<double>(spins);
+}
+
+double SlotsSimStats::variance() const {
+    if (spins < 2) return 0.0;
+
+    const double n = static_cast<double>(spins);
+    const double mean = rtp();
+    const double meanSquare = static_cast<double>(totalReturnSquared()) / n;
+
+    return (meanSquare - mean * mean) * n / (n - 1.0);
+}
+
+double SlotsSimStats::rtpMargin(double z) const {
+    if (spins == 0) return 0.0;
+    return z * std::sqrt(variance() / static_cast<double>(spins));
+}
+
+double SlotsSimStats::hitFrequencyMargin(double z) const {
+    if (spins == 0) return 0.0;
+    const double p = hitFrequency();
+    return z * std::sqrt(p * (1.0 - p) / static_cast<double>(spins));
+}
+
+SlotsSimStats SlotsSimulator::runShard(uint64_t spins, Rng& rng) {
+    // Counters indexed by outcome: [0] miss, [1..6] pairs, [7..12] triples.
+    std::array<uint64_t, 1 + 2 * SlotsRules::SYMBOL_COUNT> counts{};
+
+    for (uint64_t i = 0; i < spins; ++i) {
+        const SlotsOutcome outcome = SlotsRules::evaluate(SlotsRules::spin(rng));
+        const int bucket = (outcome.kind == SlotsOutcomeKind::NONE) ? 0 :
+                           (outcome.kind == SlotsOutcomeKind::PAIR) ? 1 + outcome.symbol :
+                           1 + SlotsRules::SYMBOL_COUNT + outcome.symbol;
+        ++counts[bucket];
+    }
+
+    SlotsSimStats stats;
+    stats.spins = spins;
+    stats.misses = counts[0];
+    for (int i = 0; i < SlotsRules::SYMBOL_COUNT; ++i) {
+        stats.pairs[i] = counts[1 + i];
+        stats.triples[i] = counts[1 + SlotsRules::SYMBOL_COUNT + i];
+    }
+
+    return stats;
+}
+
+SlotsSimStats SlotsSimulator::run(const SlotsSimConfig& config) {
+    // Rounded up without spins + SHARD_SPINS - 1, which wraps near UINT64_MAX
+    const uint64_t shards = std::max<uint64_t>(1, config.spins / SHARD_SPINS + (config.spins % SHARD_SPINS != 0));
+
+    std::vector<Rng> streams;
+    std::vector<SlotsSimStats> results;
+    try {
+        streams.reserve(shards);
+        results.resize(shards);
+    } catch (const std::exception&) {
+        // std::bad_alloc or std::length_error: the budget is far beyond anything runnable
+        throw std::invalid_argument(
+            "SlotsSimulator::run: spins (" + std::to_string(config.spins) + ") need too many shards (" +
+            std::to_string(shards) + ")"
+        );
+    }
+
+    // Shard k draws from stream k (as Rng::forStream(seed, k)), whatever thread runs it
+    Rng cursor = Rng::forStream(config.seed, 0);
+    for (uint64_t k = 0; k < shards; ++k) {
+        streams.push_back(cursor.split());
+    }
+
+    TaskPool pool(config.threads);
+    pool.parallelFor(shards, [&](size_t k) {
+        const uint64_t shardSpins = std::min<uint64_t>(SHARD_SPINS, config.spins - k * SHARD_SPINS);
+        results[k] = runShard(shardSpins, streams[k]);
+    });
+
+    SlotsSimStats total;
+    for (const auto& result : results) {
+        total.merge(result);
+    }
+
+    return total;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file SlotsSimulator.h
+ * @brief Headless multi-threaded Monte Carlo simulator for the slot machine
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_SLOTSSIMULATOR_H
+#define KASYNO_SLOTSSIMULATOR_H
+
+#include <array>
+#include <cstdint>
+
+#include "../Games/SlotsRules.h"
+
+/**
+ * @struct SlotsSimConfig
+ * @brief Parameters of a simulation run
+ */
+struct SlotsSimConfig {
+    uint64_t spins = 1'000'000;  ///< Total number of spins to simulate
+    unsigned threads = 0;        ///< Worker count (0 = all hardware threads)
+    uint64_t seed = 0;           ///< Master seed, every shard derives its own stream
+};
+
+/**
+ * @struct SlotsSimStats
+ * @brief Aggregated results of a simulation run
+ *
+ * Only outcome counts are stored, every statistic is derived from them,
+ * so merging shard results is exact.
+ */
+struct SlotsSimStats {
+    uint64_t spins = 0;                                          ///< Number of simulated spins
+    uint64_t misses = 0;                                         ///< Spins without any payout
+    std::array<uint64_t, SlotsRules::SYMBOL_COUNT> triples{};    ///< Triple count per symbol
+    std::array<uint64_t, SlotsRules::SYMBOL_COUNT> pairs{};      ///< Pair count per symbol
+
+    /**
+     * @brief Adds counts from another run
+     * @param other Stats to merge in
+     */
+    void merge(const SlotsSimStats& other);
+
+    /**
+     * @brief Sum of multipliers over all spins (total return for a unit bet)
+     * @return uint64_t Total return
+     */
+    uint64_t totalReturn() const;
+
+    /**
+     * @brief Sum of squared multipliers over all spins
+     * @return uint64_t Sum of squares
+     */
+    uint64_t totalReturnSquared() const;
+
+    /**
+     * @brief Return to player (mean multiplier)
+     * @return double RTP as a fraction (0.95 = 95%)
+     */
+    double rtp() const;
+
+    /**
+     * @brief Fraction of spins paying anything
+     * @return double Hit frequency
+     */
+    double hitFrequency() const;
+
+    /**
+     * @brief Sample variance of the per-spin multiplier
+     * @return double Variance
+     */
+    double variance() const;
+
+    /**
+     * @brief Half-width of the confidence interval for RTP
+     * @param z Standard normal quantile (1.96 = 95%)
+     * @return double Half-width
+     */
+    double rtpMargin(double z = 1.96) const;
+
+    /**
+     * @brief Half-width of the confidence interval for hit frequency
+     * @param z Standard normal quantile (1.96 = 95%)
+     * @return double Half-width
+     */
+    double hitFrequencyMargin(double z = 1.96) const;
+};
+
+/**
+ * @class SlotsSimulator
+ * @brief Runs SlotsRules spins sharded across worker threads
+ *
+ * The spins are cut into shards of SHARD_SPINS run on a TaskPool. Shard k
+ * draws from substream k of the seed, so shards never overlap and a run
+ * is reproducible from its seed alone, whatever the thread count. Shards
+ * only touch their own counters, the results are merged in shard order.
+ */
+class SlotsSimulator {
+public:
+    static constexpr uint64_t SHARD_SPINS = 1 << 22;  ///< Spins per task (tens of milliseconds)
+
+    /**
+     * @brief Simulates a single shard on the calling thread
+     * @param spins Number of spins
+     * @param rng Random number generator to use
+     * @return SlotsSimStats Shard results
+     */
+    static SlotsSimStats runShard(uint64_t spins, Rng& rng);
+
+    /**
+     * @brief Runs the full simulation
+     * @param config Simulation parameters
+     * @return SlotsSimStats Merged results from all shards
+     * @throws std::invalid_argument if the shards of the spin budget cannot be allocated
+     */
+    static SlotsSimStats run(const SlotsSimConfig& config);
+};
+
+#endif //KASYNO_SLOTSSIMULATOR_H
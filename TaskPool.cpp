@@ -0,0 +1,167 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "TaskPool.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+    thread_local TaskPool* currentPool = nullptr;  ///< Pool the calling thread works for
+    thread_local size_t currentWorker = 0;         ///< Index of the calling worker in currentPool
+}
+
+TaskPool::TaskPool(unsigned threads) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (unsigned i = 0; i < threads; ++i) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+
+    this->threads.reserve(threads);
+    for (unsigned i = 0; i < threads; ++i) {
+        this->threads.emplace_back(&TaskPool::run, this, i);
+    }
+}
+
+TaskPool::~TaskPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wakeup.notify_all();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void TaskPool::submit(Task task) {
+    const size_t index = currentPool == this
+        ? currentWorker
+        : nextWorker.fetch_add(1, std::memory_order_relaxed) % workers.size();
+
+    // Counted before it is visible, so a thief never takes queued below zero
+    pending.fetch_add(1);
+    queued.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> lock(workers[index]->mutex);
+        workers[index]->tasks.push_back(std::move(task));
+    }
+
+    // A worker counts itself as a sleeper before it checks queued, so
+    // either it sees this task or this sees it and wakes it up
+    if (sleepers.load() > 0) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        wakeup.notify_one();
+    }
+}
+
+void TaskPool::submitBatch(std::vector<Task>& tasks) {
+    if (tasks.empty()) return;
+
+    pending.fetch_add(tasks.size());
+    queued.fetch_add(tasks.size());
+
+    // Worker w gets tasks w, w + n, w + 2n... so each starts on its own part
+    const size_t count = workers.size();
+    for (size_t w = 0; w < count && w < tasks.size(); ++w) {
+        std::lock_guard<std::mutex> lock(workers[w]->mutex);
+        for (size_t i = w; i < tasks.size(); i += count) {
+            workers[w]->tasks.push_back(std::move(tasks[i]));
+        }
+    }
+    tasks.clear();
+
+    if (sleepers.load() > 0) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        wakeup.notify_all();
+    }
+}
+
+bool TaskPool::takeTask(size_t index, Task& task) {
+    Worker& own = *workers[index];
+    {
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+
+    for (size_t offset = 1; offset < workers.size(); ++offset) {
+        Worker& victim = *workers[(index + offset) % workers.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            own.stolen.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void TaskPool::run(size_t index) {
+    currentPool = this;
+    currentWorker = index;
+    Task task;
+
+    while (true) {
+        if (takeTask(index, task)) {
+            queued.fetch_sub(1);
+
+            try {
+                task();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(sleepMutex);
+                if (!failure) failure = std::current_exception();
+            }
+            task = nullptr;
+            workers[index]->executed.fetch_add(1, std::memory_order_relaxed);
+
+            if (pending.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(sleepMutex);
+                idle.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepers.fetch_add(1);
+        wakeup.wait(lock, [this] { return stopping || queued.load() > 0; });
+        sleepers.fetch_sub(1);
+
+        if (stopping && queued.load() == 0) return;
+    }
+}
+
+void TaskPool::wait() {
+    std::unique_lock<std::mutex> lock(sleepMutex);
+    idle.wait(lock, [this] { return pending.load() == 0; });
+
+    if (failure) {
+        std::rethrow_exception(std::exchange(failure, nullptr));
+    }
+}
+
+uint64_t TaskPool::getSteals() const {
+    uint64_t steals = 0;
+    for (const auto& worker : workers) {
+        steals += worker->stolen.load(std::memory_order_relaxed);
+    }
+    return steals;
+}
+
+std::vector<uint64_t> TaskPool::getExecuted() const {
+    std::vector<uint64_t> executed;
+    for (const auto& worker : workers) {
+        executed.push_back(worker->executed.load(std::memory_order_relaxed));
+    }
+    return executed;
+}
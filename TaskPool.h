@@ -0,0 +1,157 @@
+/**
+ * @file TaskPool.h
+ * @brief Work-stealing thread pool for rounds, simulation shards and sessions
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_TASKPOOL_H
+#define KASYNO_TASKPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class TaskPool
+ * @brief Fixed set of workers, each with its own task deque
+ *
+ * A worker pops its newest task (the one whose data is still in its
+ * cache) and, when its deque is empty, steals the oldest task of another
+ * worker. Cheap tasks (slot spins) and long ones (blackjack shoes, busy
+ * sessions) therefore even out across the cores on their own, without
+ * guessing shard sizes up front.
+ *
+ * Tasks submitted from a worker go to that worker's deque; tasks from
+ * other threads are spread round robin. wait() returns once every task
+ * submitted so far has finished and rethrows the first exception a task
+ * threw. It must not be called from a task.
+ */
+class TaskPool {
+public:
+    using Task = std::function<void()>;  ///< Unit of work
+
+private:
+    /**
+     * @struct Worker
+     * @brief Deque and counters of one worker (own cache line)
+     */
+    struct alignas(64) Worker {
+        std::mutex mutex;                   ///< Guards tasks
+        std::deque<Task> tasks;             ///< Back: owner's end, front: thieves' end
+        std::atomic<uint64_t> executed{0};  ///< Tasks run by this worker
+        std::atomic<uint64_t> stolen{0};    ///< Tasks taken from other workers
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;  ///< Per-worker deques
+    std::vector<std::thread> threads;              ///< Worker threads
+    std::atomic<size_t> queued{0};                 ///< Tasks sitting in deques
+    std::atomic<size_t> pending{0};                ///< Tasks submitted and not finished
+    std::atomic<size_t> sleepers{0};               ///< Workers waiting for tasks
+    std::atomic<size_t> nextWorker{0};             ///< Round robin for outside submissions
+    bool stopping = false;                         ///< Destructor asked the workers to exit
+
+    std::mutex sleepMutex;                         ///< Guards stopping, failure and the condition variables
+    std::condition_variable wakeup;                ///< Signals new tasks or stop
+    std::condition_variable idle;                  ///< Signals pending reaching zero
+    std::exception_ptr failure;                    ///< First exception thrown by a task
+
+    /**
+     * @brief Takes a task: own newest first, then the oldest of another worker
+     * @param index Worker looking for work
+     * @param task Output task
+     * @return bool True if a task was taken
+     */
+    bool takeTask(size_t index, Task& task);
+
+    /**
+     * @brief Worker loop - runs tasks until stopped and drained
+     * @param index Worker index
+     */
+    void run(size_t index);
+
+public:
+    /**
+     * @brief Constructor - starts the workers
+     * @param threads Worker count (0 = all hardware threads)
+     */
+    explicit TaskPool(unsigned threads = 0);
+
+    /**
+     * @brief Destructor - finishes every queued task, then stops the workers
+     */
+    ~TaskPool();
+
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    /**
+     * @brief Queues a task
+     * @param task Task to run on some worker
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Queues many tasks at once, spread evenly over the workers
+     *
+     * Takes each deque lock once and wakes the sleeping workers once,
+     * instead of once per task.
+     *
+     * @param tasks Tasks to run (emptied)
+     */
+    void submitBatch(std::vector<Task>& tasks);
+
+    /**
+     * @brief Waits until every submitted task has finished
+     * @throws Rethrows the first exception a task threw since the last wait()
+     */
+    void wait();
+
+    /**
+     * @brief Runs body(0) ... body(count - 1) on the pool and waits for them
+     * @param count Number of calls
+     * @param body Function taking the index
+     * @throws Rethrows the first exception body threw
+     */
+    template <typename Body>
+    void parallelFor(size_t count, const Body& body) {
+        std::vector<Task> tasks;
+        tasks.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            tasks.emplace_back([&body, i] { body(i); });
+        }
+        submitBatch(tasks);
+        wait();
+    }
+
+    /**
+     * @brief Gets the number of workers
+     * @return size_t Worker count
+     */
+    size_t size() const { return workers.size(); }
+
+    /**
+     * @brief Gets how many tasks were stolen so far
+     * @return uint64_t Steals over all workers
+     */
+    uint64_t getSteals() const;
+
+    /**
+     * @brief Gets how many tasks each worker ran so far
+     * @return std::vector<uint64_t> Task count by worker
+     */
+    std::vector<uint64_t> getExecuted() const;
+};
+
+#endif //KASYNO_TASKPOOL_H
@@ -0,0 +1,105 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "TerminalGeometry.h"
+
+#include <atomic>
+#include <mutex>
+
+#include "Platform/Platform.h"
+
+using Clock = std::chrono::steady_clock;
+
+static std::atomic<uint32_t> resizeSignals{0};  ///< Bumped by the SIGWINCH handler
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "resize counter must be usable from a signal handler");
+
+/**
+ * @struct GeometryCache
+ * @brief Last known terminal size
+ */
+struct GeometryCache {
+    std::atomic<int> columns{TerminalGeometry::DEFAULT_COLUMNS};  ///< Cached width
+    std::atomic<int> rows{TerminalGeometry::DEFAULT_ROWS};        ///< Cached height
+    std::atomic<uint64_t> version{0};                             ///< Bumped when the size changes
+    std::atomic<uint32_t> seenSignals{0};                         ///< resizeSignals at the last query
+    std::atomic<Clock::rep> lastQuery{0};                         ///< Time of the last query
+    bool signalDriven = false;                                    ///< Whether SIGWINCH keeps the cache fresh
+    std::mutex queryMutex;                                        ///< Serializes queries
+};
+
+/**
+ * @brief Resize handler (signal context) - only marks the cached size stale
+ */
+static void onResize(int) {
+    resizeSignals.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Asks for the size and updates the cache (bumps the version on a change)
+ * @param cache Cache to update
+ */
+static void updateCache(GeometryCache& cache) {
+    std::lock_guard<std::mutex> lock(cache.queryMutex);
+
+    // Signals that arrive during the query are seen by the next lookup
+    cache.seenSignals.store(resizeSignals.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    cache.lastQuery.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+
+    int columns = TerminalGeometry::DEFAULT_COLUMNS;
+    int rows = TerminalGeometry::DEFAULT_ROWS;
+    Platform::terminalSize(columns, rows);
+
+    if (columns != cache.columns.load(std::memory_order_relaxed) ||
+        rows != cache.rows.load(std::memory_order_relaxed)) {
+        cache.columns.store(columns, std::memory_order_relaxed);
+        cache.rows.store(rows, std::memory_order_relaxed);
+        cache.version.fetch_add(1, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Gets the cache, refreshing it if the size may have changed
+ * @return GeometryCache& Up-to-date cache
+ */
+static GeometryCache& freshCache() {
+    static GeometryCache cache;
+    static const bool initialized = [] {
+        cache.signalDriven = Platform::watchTerminalResize(onResize);
+        updateCache(cache);
+        return true;
+    }();
+    (void)initialized;
+
+    bool stale;
+    if (cache.signalDriven) {
+        stale = resizeSignals.load(std::memory_order_relaxed) != cache.seenSignals.load(std::memory_order_relaxed);
+    } else {
+        const Clock::duration sinceQuery = Clock::now().time_since_epoch() -
+                                           Clock::duration(cache.lastQuery.load(std::memory_order_relaxed));
+        stale = sinceQuery >= TerminalGeometry::POLL_INTERVAL;
+    }
+
+    if (stale) updateCache(cache);
+    return cache;
+}
+
+int TerminalGeometry::columns() {
+    return freshCache().columns.load(std::memory_order_relaxed);
+}
+
+int TerminalGeometry::rows() {
+    return freshCache().rows.load(std::memory_order_relaxed);
+}
+
+uint64_t TerminalGeometry::version() {
+    return freshCache().version.load(std::memory_order_acquire);
+}
+
+void TerminalGeometry::refresh() {
+    updateCache(freshCache());
+}
+
+bool TerminalGeometry::isSignalDriven() {
+    return freshCache().signalDriven;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file TerminalGeometry.h
+ * @brief Cached terminal size, refreshed when the window is resized
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_TERMINALGEOMETRY_H
+#define KASYNO_TERMINALGEOMETRY_H
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @class TerminalGeometry
+ * @brief Size of the terminal the UI draws to, without a system call per lookup
+ *
+ * The size is asked from the system once and cached. On POSIX a SIGWINCH
+ * handler marks the cache stale, so a lookup is a couple of loads until the
+ * window is resized. Where the signal is not available (Windows, or another
+ * handler is already installed) the size is asked again at most every
+ * POLL_INTERVAL.
+ */
+class TerminalGeometry {
+public:
+    static constexpr int DEFAULT_COLUMNS = 80;  ///< Width when the output is not a terminal
+    static constexpr int DEFAULT_ROWS = 24;     ///< Height when the output is not a terminal
+    static constexpr std::chrono::milliseconds POLL_INTERVAL{250};  ///< Refresh period without SIGWINCH
+
+    /**
+     * @brief Gets the terminal width
+     * @return int Width in columns
+     */
+    static int columns();
+
+    /**
+     * @brief Gets the terminal height
+     * @return int Height in rows
+     */
+    static int rows();
+
+    /**
+     * @brief Gets a number that changes whenever the size changes
+     * @return uint64_t Size version (compare with a value saved earlier)
+     */
+    static uint64_t version();
+
+    /**
+     * @brief Asks the system for the size now, ignoring the cache
+     */
+    static void refresh();
+
+    /**
+     * @brief Checks whether resizes are reported by a signal
+     * @return bool True if SIGWINCH is used, false if the size is polled
+     */
+    static bool isSignalDriven();
+};
+
+#endif //KASYNO_TERMINALGEOMETRY_H
@@ -0,0 +1,76 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "TextWidth.h"
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+#include "ScreenBuffer.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define KASYNO_TEXTWIDTH_SSE2 1
+#endif
+
+size_t TextWidth::asciiPrefix(std::string_view text) {
+    const char* data = text.data();
+    const size_t size = text.size();
+    size_t i = 0;
+
+#ifdef KASYNO_TEXTWIDTH_SSE2
+    // The sign bit of every byte is set exactly for non-ASCII bytes
+    for (; i + 16 <= size; i += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(chunk));
+        if (mask != 0) return i + static_cast<size_t>(std::countr_zero(mask));
+    }
+#endif
+
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        const uint64_t high = word & 0x8080808080808080ULL;
+        if (high != 0) {
+            const int bit = std::endian::native == std::endian::little ? std::countr_zero(high) : std::countl_zero(high);
+            return i + static_cast<size_t>(bit / 8);
+        }
+    }
+
+    while (i < size && static_cast<unsigned char>(data[i]) < 0x80) ++i;
+    return i;
+}
+
+int TextWidth::measure(std::string_view text) {
+    int width = 0;
+
+    for (size_t i = 0; i < text.size(); ) {
+        const size_t ascii = asciiPrefix(text.substr(i));
+        width += static_cast<int>(ascii);
+        i += ascii;
+
+        if (i < text.size()) {
+            width += ScreenBuffer::codepointWidth(ScreenBuffer::decodeUtf8(text, i));
+        }
+    }
+
+    return width;
+}
+
+int TextWidth::measureVisible(std::string_view text) {
+    int width = 0;
+
+    while (!text.empty()) {
+        const size_t escape = text.find("\x1b[");
+        width += measure(text.substr(0, escape));
+        if (escape == std::string_view::npos) break;
+
+        const size_t end = text.find('m', escape + 2);
+        if (end == std::string_view::npos) break;
+        text.remove_prefix(end + 1);
+    }
+
+    return width;
+}
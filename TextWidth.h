@@ -0,0 +1,80 @@
+/**
+ * @file TextWidth.h
+ * @brief Terminal display width of UTF-8 text, with an ASCII fast path
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_TEXTWIDTH_H
+#define KASYNO_TEXTWIDTH_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+
+/**
+ * @class TextWidth
+ * @brief Measures how many terminal columns a string takes
+ *
+ * Most UI lines are plain ASCII, one column per byte. Runs of ASCII are
+ * skipped 16 bytes at a time (SSE2, 8 bytes elsewhere) and only the
+ * multi-byte code points are decoded.
+ */
+class TextWidth {
+public:
+    /**
+     * @brief Gets the length of the leading ASCII run
+     * @param text UTF-8 text
+     * @return size_t Number of bytes before the first non-ASCII byte
+     */
+    static size_t asciiPrefix(std::string_view text);
+
+    /**
+     * @brief Gets the display width of UTF-8 text
+     * @param text UTF-8 text without escape sequences
+     * @return int Display width in columns
+     */
+    static int measure(std::string_view text);
+
+    /**
+     * @brief Gets the display width of text with ANSI color codes
+     * @param text UTF-8 text that may contain SGR sequences ("\x1b[...m")
+     * @return int Display width in columns, color codes excluded
+     */
+    static int measureVisible(std::string_view text);
+};
+
+/**
+ * @struct MeasuredText
+ * @brief Text together with its display width, measured once
+ *
+ * Used for constant content (slot symbols) drawn in every frame.
+ */
+struct MeasuredText {
+    std::string text;  ///< UTF-8 text
+    int width = 0;     ///< Display width in columns
+
+    /**
+     * @brief Default constructor - empty text
+     */
+    MeasuredText() = default;
+
+    /**
+     * @brief Constructor - measures the text
+     * @param text UTF-8 text
+     */
+    MeasuredText(std::string text): text(std::move(text)), width(TextWidth::measure(this->text)) {}
+
+    /**
+     * @brief Constructor - measures the text
+     * @param text UTF-8 text
+     */
+    MeasuredText(const char* text): MeasuredText(std::string(text)) {}
+};
+
+#endif //KASYNO_TEXTWIDTH_H
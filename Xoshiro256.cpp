@@ -0,0 +1,66 @@
+//
+// Created by moskw on 17.10.2026.
+//
+
+#include "Xoshiro256.h"
+
+/**
+ * @brief SplitMix64 step, used to expand a single seed into the full state
+ * @param x Generator state, advanced in place
+ * @return uint64_t Next value
+ */
+static uint64_t splitMix64(uint64_t& x) {
+    uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+Xoshiro256::Xoshiro256(uint64_t seed) {
+    this->seed(seed);
+}
+
+void Xoshiro256::seed(uint64_t seed) {
+    for (auto& word : state) {
+        word = splitMix64(seed);
+    }
+}
+
+void Xoshiro256::applyJump(const std::array<uint64_t, 4>& polynomial) {
+    std::array<uint64_t, 4> jumped{};
+
+    for (uint64_t word : polynomial) {
+        for (int bit = 0; bit < 64; ++bit) {
+            if (word & (1ULL << bit)) {
+                for (int i = 0; i < 4; ++i) {
+                    jumped[i] ^= state[i];
+                }
+            }
+            (*this)();
+        }
+    }
+
+    state = jumped;
+}
+
+void Xoshiro256::jump() {
+    static constexpr std::array<uint64_t, 4> JUMP = {
+        0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+        0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+    };
+    applyJump(JUMP);
+}
+
+void Xoshiro256::longJump() {
+    static constexpr std::array<uint64_t, 4> LONG_JUMP = {
+        0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL,
+        0x77710069854EE241ULL, 0x39109BB02ACBE635ULL
+    };
+    applyJump(LONG_JUMP);
+}
+
+void Xoshiro256::discard(uint64_t count) {
+    for (uint64_t i = 0; i < count; ++i) {
+        (*this)();
+    }
+}
@@ -0,0 +1,99 @@
+/**
+ * @file Xoshiro256.h
+ * @brief xoshiro256** random engine with jump-ahead support
+ * @author Marczelloo
+ * @date 2026-10-17
+ */
+
+//
+// Created by moskw on 17.10.2026.
+//
+
+#ifndef KASYNO_XOSHIRO256_H
+#define KASYNO_XOSHIRO256_H
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @class Xoshiro256
+ * @brief xoshiro256** generator (Blackman & Vigna) with 32 bytes of state
+ *
+ * Satisfies UniformRandomBitGenerator, so it works with std distributions.
+ * jump() advances the state by 2^128 draws and longJump() by 2^192 draws,
+ * which splits one seed into non-overlapping substreams.
+ */
+class Xoshiro256 {
+    std::array<uint64_t, 4> state{};  ///< Generator state (never all zero)
+
+    /**
+     * @brief Rotates bits left
+     * @param x Value to rotate
+     * @param k Number of bits
+     * @return uint64_t Rotated value
+     */
+    static constexpr uint64_t rotl(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    /**
+     * @brief XORs together the states reached after each set bit of a jump polynomial
+     * @param polynomial Jump polynomial
+     */
+    void applyJump(const std::array<uint64_t, 4>& polynomial);
+public:
+    using result_type = uint64_t;  ///< Type of generated values
+
+    /**
+     * @brief Constructor - seeds the generator
+     * @param seed Seed value (expanded with SplitMix64)
+     */
+    explicit Xoshiro256(uint64_t seed = 0);
+
+    /**
+     * @brief Reseeds the generator
+     * @param seed Seed value (expanded with SplitMix64)
+     */
+    void seed(uint64_t seed);
+
+    /**
+     * @brief Generates next 64-bit value
+     * @return uint64_t Random value
+     */
+    uint64_t operator()() {
+        const uint64_t result = rotl(state[1] * 5, 7) * 9;
+        const uint64_t t = state[1] << 17;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+
+        return result;
+    }
+
+    /**
+     * @brief Advances the state by 2^128 draws (next substream)
+     */
+    void jump();
+
+    /**
+     * @brief Advances the state by 2^192 draws (next group of substreams)
+     */
+    void longJump();
+
+    /**
+     * @brief Skips a number of draws
+     * @param count Number of values to skip
+     */
+    void discard(uint64_t count);
+
+    static constexpr uint64_t min() { return 0; }
+    static constexpr uint64_t max() { return std::numeric_limits<uint64_t>::max(); }
+};
+
+#endif //KASYNO_XOSHIRO256_H